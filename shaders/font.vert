@@ -15,25 +15,18 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 // scale maps pixel coordinates to GL coordinates (-1 to 1).
 uniform vec2 scale;
-// The (x, y) coordinates of the top left corner of the glyph.
+// The (x, y) coordinates of the start of the string.
 uniform vec2 position;
-// The glyph to draw. (ASCII value - 32).
-uniform int glyph;
-// Aspect ratio of rendered glyph (unity by default).
-uniform float aspect;
-// Glyph size (in pixels).
-uniform vec2 glyphSize;
 
-// Inputs from the VBO.
+// Inputs from the VBO: the offset of this corner of a glyph from the start of
+// the string (in pixels), and the point in the texture that it corresponds to.
 in vec2 vert;
-in vec2 corner;
+in vec2 glyphCoord;
 
 // Output to the fragment shader.
 out vec2 texCoord;
 
-// Pick the proper glyph out of the texture.
 void main() {
-	texCoord = vec2((float(glyph) + corner.x) / 98.f, corner.y);
-	vec2 pos = vert * glyphSize;
-	gl_Position = vec4((aspect * pos.x + position.x) * scale.x, (pos.y + position.y) * scale.y, 0.f, 1.f);
+	texCoord = glyphCoord;
+	gl_Position = vec4((vert + position) * scale, 0.f, 1.f);
 }
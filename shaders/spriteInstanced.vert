@@ -0,0 +1,45 @@
+/* spriteInstanced.vert
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+precision mediump float;
+
+uniform vec2 scale;
+uniform int useBlur;
+
+// The corner of the quad.
+in vec2 vert;
+// The values that differ between the instances of a sprite.
+in vec2 position;
+in vec4 transform;
+in vec2 blur;
+in float clip;
+in float alpha;
+in float frame;
+
+out vec2 fragTexCoord;
+flat out vec2 fragBlur;
+flat out float fragAlpha;
+flat out float fragFrame;
+
+void main() {
+	fragBlur = useBlur > 0 ? blur : vec2(0.f, 0.f);
+	fragAlpha = alpha;
+	fragFrame = frame;
+
+	vec2 blurOff = 2.f * vec2(vert.x * abs(fragBlur.x), vert.y * abs(fragBlur.y));
+	gl_Position = vec4((mat2(transform) * (vert + blurOff) + position) * scale, 0, 1);
+	vec2 texCoord = vert + vec2(.5, .5);
+	fragTexCoord = vec2(texCoord.x, min(clip, texCoord.y)) + blurOff;
+}
@@ -15,6 +15,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "AI.h"
 
+#include "Attribute.h"
 #include "audio/Audio.h"
 #include "Command.h"
 #include "ConditionsStore.h"
@@ -39,6 +40,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Point.h"
 #include "Port.h"
 #include "Preferences.h"
+#include "Profiler.h"
 #include "Random.h"
 #include "RoutePlan.h"
 #include "Ship.h"
@@ -289,7 +291,7 @@ namespace {
 			return false;
 
 		// If the ship doesn't have fuel, no refuel.
-		double fuelCapacity = ship.Attributes().Get("fuel capacity");
+		double fuelCapacity = ship.Attributes().Get(Attribute::FUEL_CAPACITY);
 		if(!fuelCapacity)
 			return false;
 
@@ -393,12 +395,33 @@ namespace {
 	// another in case they become too close.
 	constexpr double SCATTER_TOO_CLOSE = 20. * 20.;
 	constexpr double SCATTER_TRACK = 100. * 100.;
+
+	// The grid used to find the ships near a given ship. The cells are large
+	// because most range queries cover thousands of pixels.
+	constexpr unsigned SHIP_GRID_CELL_SIZE = 1024;
+	constexpr unsigned SHIP_GRID_CELL_COUNT = 64;
+
+	// Ships within this range count their allies' strength as their own.
+	constexpr double ALLY_STRENGTH_RANGE = 2000.;
+
+	// The most that FindTarget() can lower a foe's score below its distance
+	// for being the previous target, having been boarded, or having boarded
+	// this ship's government, not counting the foe's shields, hull and heat.
+	constexpr double MAX_TARGET_SCORE_BONUS = 500. + 2000. + 1000.;
+
+	// The most routes to keep cached. Each distinct combination of a ship's
+	// location, jump capabilities, and destination needs its own route.
+	constexpr size_t MAX_ROUTE_CACHE_SIZE = 4096;
+	// The most route searches to keep for continuing later. Each one holds the
+	// routes to all the systems it reached.
+	constexpr size_t MAX_ROUTE_SEARCHES = 256;
 }
 
 
 
 AI::AI(PlayerInfo &player, const List<Ship> &ships, const List<Minable> &minables, const List<Flotsam> &flotsam)
-	: player(player), ships(ships), minables(minables), flotsam(flotsam), routeCache()
+	: player(player), ships(ships), minables(minables), flotsam(flotsam),
+	shipGrid(SHIP_GRID_CELL_SIZE, SHIP_GRID_CELL_COUNT, CollisionType::SHIP), routeCache()
 {
 	// Allocate a starting amount of hardpoints for ships.
 	firingCommands.SetHardpoints(12);
@@ -663,12 +686,19 @@ void AI::Clean()
 	boarders.clear();
 	closeBy.clear();
 	routeCache.clear();
+	routeList.clear();
+	routeSearches.clear();
 	// Records for formations flying around lead ships and other objects.
 	formations.clear();
 	// Records that affect the combat behavior of various governments.
 	shipStrength.clear();
+	listedGovernments.clear();
+	governmentRosters.clear();
+	governmentStrength.clear();
 	enemyStrength.clear();
 	allyStrength.clear();
+	facesEnemies.Clear();
+	listedShips.clear();
 }
 
 
@@ -685,10 +715,11 @@ void AI::ClearOrders()
 
 void AI::Step(Command &activeCommands)
 {
+	Profiler::Scope profile("AI::Step");
+
 	// First, figure out the comparative strengths of the present governments.
 	const System *playerSystem = player.GetSystem();
-	map<const Government *, int64_t> strength;
-	UpdateStrengths(strength, playerSystem);
+	UpdateStrengths(playerSystem);
 	CacheShipLists();
 
 	// Update the counts of how long ships have been outside the "invisible fence."
@@ -833,8 +864,8 @@ void AI::Step(Command &activeCommands)
 			// government to this ship, and this ship has scanning capabilities
 			// then it was attempting to scan the target. This isn't a perfect
 			// assumption, but should be good enough for now.
-			bool cargoScan = it->Attributes().Get("cargo scan power");
-			bool outfitScan = it->Attributes().Get("outfit scan power");
+			bool cargoScan = it->Attributes().Get(Attribute::CARGO_SCAN_POWER);
+			bool outfitScan = it->Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 			if((cargoScan || outfitScan) && target && !target->IsDisabled()
 				&& !target->GetGovernment()->IsEnemy(gov) && target->GetGovernment() != gov)
 			{
@@ -1192,7 +1223,7 @@ void AI::Step(Command &activeCommands)
 			MoveIndependent(*it, command);
 		else if(parent->GetSystem() != it->GetSystem())
 		{
-			if(personality.IsStaying() || !it->Attributes().Get("fuel capacity"))
+			if(personality.IsStaying() || !it->Attributes().Get(Attribute::FUEL_CAPACITY))
 				MoveIndependent(*it, command);
 			else
 				MoveEscort(*it, command);
@@ -1263,16 +1294,16 @@ void AI::SetMousePosition(Point position)
 // Get the in-system strength of each government's allies and enemies.
 int64_t AI::AllyStrength(const Government *government) const
 {
-	auto it = allyStrength.find(government);
-	return (it == allyStrength.end() ? 0 : it->second);
+	const int index = ListedGovernment(government);
+	return (index < 0 ? 0 : allyStrength[index]);
 }
 
 
 
 int64_t AI::EnemyStrength(const Government *government) const
 {
-	auto it = enemyStrength.find(government);
-	return (it == enemyStrength.end() ? 0 : it->second);
+	const int index = ListedGovernment(government);
+	return (index < 0 ? 0 : enemyStrength[index]);
 }
 
 
@@ -1307,9 +1338,16 @@ const StellarObject *AI::FindLandingLocation(const Ship &ship, const bool refuel
 
 
 
+const AI::RouteCacheCounters &AI::GetRouteCacheCounters() const
+{
+	return routeCacheCounters;
+}
+
+
+
 AI::RouteCacheKey::RouteCacheKey(size_t jumpHash, size_t personalityHash, const System *to, bool isPlayer,
-	const vector<string> &wormholeKeys)
-	: jumpHash(jumpHash), personalityHash(personalityHash), to(to), isPlayer(isPlayer), wormholeKeys(wormholeKeys)
+	const Bitset &wormholeMask)
+	: jumpHash(jumpHash), personalityHash(personalityHash), to(to), isPlayer(isPlayer), wormholeMask(wormholeMask)
 {
 }
 
@@ -1323,8 +1361,7 @@ size_t AI::RouteCacheKey::HashFunction::operator()(RouteCacheKey const &key) con
 	Hasher::Hash(hash, key.personalityHash);
 	Hasher::Hash(hash, key.to);
 	Hasher::Hash(hash, key.isPlayer);
-	for(const string &k : key.wormholeKeys)
-		Hasher::Hash(hash, k);
+	Hasher::Hash(hash, key.wormholeMask.Hash());
 	return hash;
 }
 
@@ -1337,7 +1374,7 @@ bool AI::RouteCacheKey::operator==(const RouteCacheKey &other) const
 		&& personalityHash == other.personalityHash
 		&& to == other.to
 		&& isPlayer == other.isPlayer
-		&& wormholeKeys == other.wormholeKeys;
+		&& wormholeMask == other.wormholeMask;
 }
 
 
@@ -1570,8 +1607,15 @@ shared_ptr<Ship> AI::FindTarget(const Ship &ship) const
 	if(!person.IsDaring() && strengthIt != shipStrength.end())
 		maxStrength = 2 * strengthIt->second;
 
-	// Get a list of all targetable, hostile ships in this system.
-	const auto enemies = GetShipsList(ship, true);
+	// Get a list of all targetable, hostile ships in this system. A foe's score
+	// can only be so much lower than how far away it is now, so any foe that is
+	// too far away to beat the initial threshold can be skipped. Nemesis ships
+	// may switch to a target at any range, though.
+	double searchRange = -1.;
+	if(!person.IsNemesis() && closest < numeric_limits<double>::infinity())
+		searchRange = closest + MAX_TARGET_SCORE_BONUS - minConditionScore
+			+ 60. * (maxListedSpeed + ship.Velocity().Length()) + 1.;
+	const auto enemies = GetShipsList(ship, true, searchRange);
 	for(const auto &foe : enemies)
 	{
 		// If this is a "nemesis" ship and it has found one of the player's
@@ -1675,8 +1719,8 @@ shared_ptr<Ship> AI::FindNonHostileTarget(const Ship &ship) const
 	// additional minute.
 	int forfeitTime = searchTime + 3600;
 
-	double cargoScan = ship.Attributes().Get("cargo scan power");
-	double outfitScan = ship.Attributes().Get("outfit scan power");
+	double cargoScan = ship.Attributes().Get(Attribute::CARGO_SCAN_POWER);
+	double outfitScan = ship.Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 	auto cargoScansIt = cargoScans.find(&ship);
 	auto outfitScansIt = outfitScans.find(&ship);
 	auto scanTimeIt = scanTime.find(&ship);
@@ -1754,17 +1798,49 @@ vector<Ship *> AI::GetShipsList(const Ship &ship, bool targetEnemies, double max
 	const auto it = rosters.find(ship.GetGovernment());
 	if(it != rosters.end() && !it->second.empty())
 	{
-		targets.reserve(it->second.size());
-
 		const System *here = ship.GetSystem();
 		const Point &p = ship.Position();
-		for(const auto &target : it->second)
-			if(target->IsTargetable() && target->GetSystem() == here
-					&& !(target->IsHyperspacing() && target->Velocity().Length() > 10.)
-					&& p.Distance(target->Position()) < maxRange
-					&& (ship.IsYours() || !target->GetPersonality().IsMarked())
-					&& (target->IsYours() || !ship.GetPersonality().IsMarked()))
-				targets.emplace_back(target);
+		auto isTarget = [&ship, here, &p, maxRange](const Ship &target) -> bool
+		{
+			return target.IsTargetable() && target.GetSystem() == here
+				&& !(target.IsHyperspacing() && target.Velocity().Length() > 10.)
+				&& p.Distance(target.Position()) < maxRange
+				&& (ship.IsYours() || !target.GetPersonality().IsMarked())
+				&& (target.IsYours() || !ship.GetPersonality().IsMarked());
+		};
+
+		// If the range only covers a few grid cells compared to the number of
+		// listed ships, look up the nearby ships instead of checking every one.
+		const double cellsAcross = 2. * maxRange / SHIP_GRID_CELL_SIZE + 2.;
+		if(cellsAcross * cellsAcross < it->second.size())
+		{
+			const unsigned government = listedGovernments.at(ship.GetGovernment());
+			const size_t governments = listedGovernments.size();
+			vector<Body *> nearby;
+			shipGrid.Circle(p, maxRange, nearby);
+
+			// Return the ships in the same order as the cached list has them.
+			vector<pair<unsigned, Ship *>> found;
+			for(Body *body : nearby)
+			{
+				Ship *target = static_cast<Ship *>(body);
+				const ListedShip &listed = listedShips.at(target);
+				if(listedHostility[government * governments + listed.government] == targetEnemies
+						&& isTarget(*target))
+					found.emplace_back(listed.order, target);
+			}
+			sort(found.begin(), found.end());
+			targets.reserve(found.size());
+			for(const auto &foundIt : found)
+				targets.emplace_back(foundIt.second);
+		}
+		else
+		{
+			targets.reserve(it->second.size());
+			for(const auto &target : it->second)
+				if(isTarget(*target))
+					targets.emplace_back(target);
+		}
 	}
 
 	return targets;
@@ -1988,8 +2064,8 @@ void AI::MoveIndependent(Ship &ship, Command &command)
 		if(target)
 		{
 			// An AI ship that is targeting a non-hostile ship should scan it, or move on.
-			bool cargoScan = ship.Attributes().Get("cargo scan power");
-			bool outfitScan = ship.Attributes().Get("outfit scan power");
+			bool cargoScan = ship.Attributes().Get(Attribute::CARGO_SCAN_POWER);
+			bool outfitScan = ship.Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 			// De-target if the target left my system.
 			if(ship.GetSystem() != target->GetSystem())
 			{
@@ -2124,7 +2200,7 @@ void AI::MoveIndependent(Ship &ship, Command &command)
 	else if(ship.GetTargetStellar())
 	{
 		MoveToPlanet(ship, command);
-		if(!shouldStay && ship.Attributes().Get("fuel capacity") && ship.GetTargetStellar()->HasSprite()
+		if(!shouldStay && ship.Attributes().Get(Attribute::FUEL_CAPACITY) && ship.GetTargetStellar()->HasSprite()
 				&& ship.GetTargetStellar()->GetPlanet() && ship.GetTargetStellar()->GetPlanet()->CanLand(ship))
 			command |= Command::LAND;
 		else if(ship.Position().Distance(ship.GetTargetStellar()->Position()) < 100.)
@@ -2157,7 +2233,7 @@ void AI::MoveEscort(Ship &ship, Command &command)
 {
 	const Ship &parent = *ship.GetParent();
 	const System *currentSystem = ship.GetSystem();
-	bool hasFuelCapacity = ship.Attributes().Get("fuel capacity");
+	bool hasFuelCapacity = ship.Attributes().Get(Attribute::FUEL_CAPACITY);
 	bool needsFuel = ship.NeedsFuel();
 	bool isStaying = ship.GetPersonality().IsStaying() || !hasFuelCapacity;
 	bool parentIsHere = (currentSystem == parent.GetSystem());
@@ -2437,9 +2513,9 @@ bool AI::ShouldDock(const Ship &ship, const Ship &parent, const System *playerSy
 
 	// If a carried ship has fuel capacity but is very low, it should return if
 	// the parent can refuel it.
-	double maxFuel = ship.Attributes().Get("fuel capacity");
+	double maxFuel = ship.Attributes().Get(Attribute::FUEL_CAPACITY);
 	if(maxFuel && ship.Fuel() < .005 && parent.JumpNavigation().JumpFuel() < parent.Fuel() *
-			parent.Attributes().Get("fuel capacity") - maxFuel)
+			parent.Attributes().Get(Attribute::FUEL_CAPACITY) - maxFuel)
 		return true;
 
 	// NPC ships should always transfer cargo. Player ships should only
@@ -2604,7 +2680,7 @@ bool AI::Stop(const Ship &ship, Command &command, double maxSpeed, const Point &
 
 	// If you have a reverse thruster, figure out whether using it is faster
 	// than turning around and using your main thruster.
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(Attribute::REVERSE_THRUST))
 	{
 		// Figure out your stopping time using your main engine:
 		double degreesToTurn = TO_DEG * acos(min(1., max(-1., -velocity.Unit().Dot(angle.Unit()))));
@@ -2650,7 +2726,7 @@ bool AI::Stop(const Ship &ship, Command &command, double maxSpeed, const Point &
 void AI::PrepareForHyperspace(const Ship &ship, Command &command)
 {
 	bool hasHyperdrive = ship.JumpNavigation().HasHyperdrive();
-	double scramThreshold = ship.Attributes().Get("scram drive");
+	double scramThreshold = ship.Attributes().Get(Attribute::SCRAM_DRIVE);
 	bool hasJumpDrive = ship.JumpNavigation().HasJumpDrive();
 	if(!hasHyperdrive && !hasJumpDrive)
 		return;
@@ -2700,9 +2776,9 @@ void AI::PrepareForHyperspace(const Ship &ship, Command &command)
 	}
 	// If we're a jump drive, just stop.
 	else if(isJump)
-		Stop(ship, command, ship.Attributes().Get("jump speed"));
+		Stop(ship, command, ship.Attributes().Get(Attribute::JUMP_SPEED));
 	// Else stop in the fastest way to end facing in the right direction
-	else if(Stop(ship, command, ship.Attributes().Get("jump speed"), direction))
+	else if(Stop(ship, command, ship.Attributes().Get(Attribute::JUMP_SPEED), direction))
 		command.SetTurn(TurnToward(ship, direction));
 }
 
@@ -2814,11 +2890,11 @@ void AI::KeepStation(const Ship &ship, Command &command, const Body &target)
 
 	// Determine whether to apply thrust.
 	Point drag = ship.Velocity() * ship.DragForce();
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(Attribute::REVERSE_THRUST))
 	{
 		// Don't take drag into account when reverse thrusting, because this
 		// estimate of how it will be applied can be quite inaccurate.
-		Point a = (unit * (-ship.Attributes().Get("reverse thrust") / mass)).Unit();
+		Point a = (unit * (-ship.Attributes().Get(Attribute::REVERSE_THRUST) / mass)).Unit();
 		double direction = positionWeight * positionDelta.Dot(a) / POSITION_DEADBAND
 			+ velocityWeight * velocityDelta.Dot(a) / VELOCITY_DEADBAND;
 		if(direction > THRUST_DEADBAND)
@@ -2942,7 +3018,7 @@ void AI::MoveToAttack(const Ship &ship, Command &command, const Body &target)
 	const auto facing = ship.Facing().Unit().Dot(direction.Unit());
 	// If the ship has reverse thrusters and the target is behind it, we can
 	// use them to reach the target more quickly.
-	if(facing < -.75 && ship.Attributes().Get("reverse thrust"))
+	if(facing < -.75 && ship.Attributes().Get(Attribute::REVERSE_THRUST))
 		command |= Command::BACK;
 	// Only apply thrust if either:
 	// This ship is within 90 degrees of facing towards its target and far enough away not to overshoot
@@ -2994,18 +3070,18 @@ void AI::PickUp(const Ship &ship, Command &command, const Body &target)
 // energy strain, or undue thermal loads if almost overheated.
 bool AI::ShouldUseAfterburner(const Ship &ship)
 {
-	if(!ship.Attributes().Get("afterburner thrust"))
+	if(!ship.Attributes().Get(Attribute::AFTERBURNER_THRUST))
 		return false;
 
-	double fuel = ship.Fuel() * ship.Attributes().Get("fuel capacity");
-	double neededFuel = ship.Attributes().Get("afterburner fuel");
-	double energy = ship.Energy() * ship.Attributes().Get("energy capacity");
-	double neededEnergy = ship.Attributes().Get("afterburner energy");
+	double fuel = ship.Fuel() * ship.Attributes().Get(Attribute::FUEL_CAPACITY);
+	double neededFuel = ship.Attributes().Get(Attribute::AFTERBURNER_FUEL);
+	double energy = ship.Energy() * ship.Attributes().Get(Attribute::ENERGY_CAPACITY);
+	double neededEnergy = ship.Attributes().Get(Attribute::AFTERBURNER_ENERGY);
 	if(energy == 0.)
-		energy = ship.Attributes().Get("energy generation")
-				+ 0.2 * ship.Attributes().Get("solar collection")
-				- ship.Attributes().Get("energy consumption");
-	double outputHeat = ship.Attributes().Get("afterburner heat") / (100 * ship.Mass());
+		energy = ship.Attributes().Get(Attribute::ENERGY_GENERATION)
+				+ 0.2 * ship.Attributes().Get(Attribute::SOLAR_COLLECTION)
+				- ship.Attributes().Get(Attribute::ENERGY_CONSUMPTION);
+	double outputHeat = ship.Attributes().Get(Attribute::AFTERBURNER_HEAT) / (100 * ship.Mass());
 	if((!neededFuel || fuel - neededFuel > ship.JumpNavigation().JumpFuel())
 			&& (!neededEnergy || neededEnergy / energy < 0.25)
 			&& (!outputHeat || ship.Heat() + outputHeat < .9))
@@ -3137,7 +3213,7 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 	{
 		// Approach the planet and "land" on it (i.e. scan it).
 		MoveToPlanet(ship, command);
-		double atmosphereScan = ship.Attributes().Get("atmosphere scan");
+		double atmosphereScan = ship.Attributes().Get(Attribute::ATMOSPHERE_SCAN);
 		double distance = ship.Position().Distance(ship.GetTargetStellar()->Position());
 		if(distance < atmosphereScan && !Random::Int(100))
 			ship.SetTargetStellar(nullptr);
@@ -3147,8 +3223,8 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 	else if(target)
 	{
 		// Approach and scan the targeted, friendly ship's cargo or outfits.
-		bool cargoScan = ship.Attributes().Get("cargo scan power");
-		bool outfitScan = ship.Attributes().Get("outfit scan power");
+		bool cargoScan = ship.Attributes().Get(Attribute::CARGO_SCAN_POWER);
+		bool outfitScan = ship.Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 		// If the pointer to the target ship exists, it is targetable and in-system.
 		const Government *gov = ship.GetGovernment();
 		bool mustScanCargo = cargoScan && !Has(gov, target, ShipEvent::SCAN_CARGO);
@@ -3176,8 +3252,8 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 		// ships in high spawn rate systems don't build up over time, as they always have
 		// a new ship they can try to scan.
 		vector<Ship *> targetShips;
-		bool cargoScan = ship.Attributes().Get("cargo scan power");
-		bool outfitScan = ship.Attributes().Get("outfit scan power");
+		bool cargoScan = ship.Attributes().Get(Attribute::CARGO_SCAN_POWER);
+		bool outfitScan = ship.Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 		auto cargoScansIt = cargoScans.find(&ship);
 		auto outfitScansIt = outfitScans.find(&ship);
 		auto scanTimeIt = scanTime.find(&ship);
@@ -3201,7 +3277,7 @@ void AI::DoSurveillance(Ship &ship, Command &command, shared_ptr<Ship> &target)
 
 		// Consider scanning any planetary object in the system, if able.
 		vector<const StellarObject *> targetPlanets;
-		double atmosphereScan = ship.Attributes().Get("atmosphere scan");
+		double atmosphereScan = ship.Attributes().Get(Attribute::ATMOSPHERE_SCAN);
 		if(atmosphereScan)
 			for(const StellarObject &object : system->Objects())
 				if(object.HasSprite() && !object.IsStar() && !object.IsStation())
@@ -3371,12 +3447,12 @@ bool AI::DoCloak(const Ship &ship, Command &command) const
 		return false;
 	// Never cloak if it will cause you to be stranded.
 	const Outfit &attributes = ship.Attributes();
-	double cloakingFuel = attributes.Get("cloaking fuel");
+	double cloakingFuel = attributes.Get(Attribute::CLOAKING_FUEL);
 	double fuelCost = cloakingFuel
-		+ attributes.Get("fuel consumption") - attributes.Get("fuel generation");
-	if(cloakingFuel && !attributes.Get("ramscoop"))
+		+ attributes.Get(Attribute::FUEL_CONSUMPTION) - attributes.Get(Attribute::FUEL_GENERATION);
+	if(cloakingFuel && !attributes.Get(Attribute::RAMSCOOP))
 	{
-		double fuel = ship.Fuel() * attributes.Get("fuel capacity");
+		double fuel = ship.Fuel() * attributes.Get(Attribute::FUEL_CAPACITY);
 		int steps = ceil((1. - ship.Cloaking()) / cloakingSpeed);
 		// Only cloak if you will be able to fully cloak and also maintain it
 		// for as long as it will take you to reach full cloak.
@@ -3434,18 +3510,19 @@ bool AI::DoCloak(const Ship &ship, Command &command) const
 	// then it should cloak while under threat.
 	bool canRecoverShieldsCloaked = false;
 	bool canRecoverHullCloaked = false;
-	if(attributes.Get("cloaked regen multiplier") > -1.)
+	if(attributes.Get(Attribute::CLOAKED_REGEN_MULTIPLIER) > -1.)
 	{
-		if(attributes.Get("shield generation") > 0.)
+		if(attributes.Get(Attribute::SHIELD_GENERATION) > 0.)
 			canRecoverShieldsCloaked = true;
-		else if(attributes.Get("cloaking shield delay") < 1. && attributes.Get("delayed shield generation") > 0.)
+		else if(attributes.Get(Attribute::CLOAKING_SHIELD_DELAY) < 1.
+				&& attributes.Get(Attribute::DELAYED_SHIELD_GENERATION) > 0.)
 			canRecoverShieldsCloaked = true;
 	}
-	if(attributes.Get("cloaked repair multiplier") > -1.)
+	if(attributes.Get(Attribute::CLOAKED_REPAIR_MULTIPLIER) > -1.)
 	{
-		if(attributes.Get("hull repair rate") > 0.)
+		if(attributes.Get(Attribute::HULL_REPAIR_RATE) > 0.)
 			canRecoverHullCloaked = true;
-		else if(attributes.Get("cloaking repair delay") < 1. && attributes.Get("delayed hull repair") > 0.)
+		else if(attributes.Get(Attribute::CLOAKING_REPAIR_DELAY) < 1. && attributes.Get(Attribute::DELAYED_HULL_REPAIR) > 0.)
 			canRecoverHullCloaked = true;
 	}
 	bool cloakToRepair = (ship.Health() < RETREAT_HEALTH + hysteresis)
@@ -3613,8 +3690,8 @@ bool AI::DoSecretive(Ship &ship, Command &command) const
 		Point scanningPos = scanningShip->Position();
 		Point pos = ship.Position();
 
-		double cargoDistance = scanningShip->Attributes().Get("cargo scan power");
-		double outfitDistance = scanningShip->Attributes().Get("outfit scan power");
+		double cargoDistance = scanningShip->Attributes().Get(Attribute::CARGO_SCAN_POWER);
+		double outfitDistance = scanningShip->Attributes().Get(Attribute::OUTFIT_SCAN_POWER);
 
 		double maxScanRange = max(cargoDistance, outfitDistance);
 		double distance = scanningPos.DistanceSquared(pos) * .0001;
@@ -3671,10 +3748,10 @@ Point AI::StoppingPoint(const Ship &ship, const Point &targetVelocity, bool &sho
 	// The average term's value will be v / 2. So:
 	stopDistance += .5 * v * v / acceleration;
 
-	if(ship.Attributes().Get("reverse thrust"))
+	if(ship.Attributes().Get(Attribute::REVERSE_THRUST))
 	{
 		// Figure out your reverse thruster stopping distance:
-		double reverseAcceleration = ship.Attributes().Get("reverse thrust") / ship.InertialMass();
+		double reverseAcceleration = ship.Attributes().Get(Attribute::REVERSE_THRUST) / ship.InertialMass();
 		double reverseDistance = v * (180. - degreesToTurn) / turnRate;
 		reverseDistance += .5 * v * v / reverseAcceleration;
 
@@ -3943,9 +4020,9 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 		beFrugal = (ship.Health() > GameData::GetGamerules().UniversalFrugalThreshold());
 		if(beFrugal)
 		{
-			auto ait = allyStrength.find(ship.GetGovernment());
-			auto eit = enemyStrength.find(ship.GetGovernment());
-			if(ait != allyStrength.end() && eit != enemyStrength.end() && ait->second < eit->second)
+			const int government = ListedGovernment(ship.GetGovernment());
+			if(government >= 0 && facesEnemies.Test(government)
+					&& allyStrength[government] < enemyStrength[government])
 				beFrugal = false;
 		}
 	}
@@ -4044,7 +4121,7 @@ void AI::AutoFire(const Ship &ship, FireCommand &command, bool secondary, bool i
 		// fuel that you cannot leave the system if necessary.
 		if(weapon->FiringFuel())
 		{
-			double fuel = ship.Fuel() * ship.Attributes().Get("fuel capacity");
+			double fuel = ship.Fuel() * ship.Attributes().Get(Attribute::FUEL_CAPACITY);
 			fuel -= weapon->FiringFuel();
 			// If the ship is not ever leaving this system, it does not need to
 			// reserve any fuel.
@@ -4228,7 +4305,7 @@ double AI::RendezvousTime(const Point &p, const Point &v, double vp)
 // on the player's preferences.
 bool AI::TargetMinable(Ship &ship) const
 {
-	double scanRangeMetric = 10000. * ship.Attributes().Get("asteroid scan power");
+	double scanRangeMetric = 10000. * ship.Attributes().Get(Attribute::ASTEROID_SCAN_POWER);
 	if(!scanRangeMetric)
 		return false;
 	const bool findClosest = Preferences::Has("Target asteroid based on");
@@ -4497,7 +4574,7 @@ void AI::MovePlayer(Ship &ship, Command &activeCommands)
 			auto options = vector<ShipValue>{};
 			if(shift)
 			{
-				const auto &owned = governmentRosters[ship.GetGovernment()];
+				const auto &owned = GovernmentRoster(ship.GetGovernment());
 				options.reserve(owned.size());
 				for(auto &&escort : owned)
 					if(CanBoard(ship, *escort))
@@ -4765,7 +4842,7 @@ void AI::MovePlayer(Ship &ship, Command &activeCommands)
 		AutoFire(ship, firingCommands, false, true);
 
 	const bool mouseTurning = activeCommands.Has(Command::MOUSE_TURNING_HOLD);
-	if(mouseTurning && !ship.IsBoarding() && (!ship.IsReversing() || ship.Attributes().Get("reverse thrust")))
+	if(mouseTurning && !ship.IsBoarding() && (!ship.IsReversing() || ship.Attributes().Get(Attribute::REVERSE_THRUST)))
 		command.SetTurn(TurnToward(ship, mousePosition));
 
 	if(activeCommands)
@@ -4776,7 +4853,7 @@ void AI::MovePlayer(Ship &ship, Command &activeCommands)
 			command.SetTurn(activeCommands.Has(Command::RIGHT) - activeCommands.Has(Command::LEFT));
 		if(activeCommands.Has(Command::BACK))
 		{
-			if(!activeCommands.Has(Command::FORWARD) && ship.Attributes().Get("reverse thrust"))
+			if(!activeCommands.Has(Command::FORWARD) && ship.Attributes().Get(Attribute::REVERSE_THRUST))
 				command |= Command::BACK;
 			else if(!activeCommands.Has(Command::RIGHT | Command::LEFT | Command::AUTOSTEER))
 				command.SetTurn(TurnBackward(ship));
@@ -5000,39 +5077,102 @@ bool AI::Has(const Ship &ship, const Government *government, int type) const
 
 
 
-void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const System *playerSystem)
+void AI::UpdateStrengths(const System *playerSystem)
 {
+	// Give each government with ships in the player's system a dense index, in
+	// order of the governments' addresses so that the lists are built in the
+	// same order every step.
+	listedGovernments.clear();
+	for(const auto &it : ships)
+		if(it->GetGovernment() && it->GetSystem() == playerSystem)
+			listedGovernments.emplace(it->GetGovernment(), 0);
+	unsigned index = 0;
+	for(auto &git : listedGovernments)
+		git.second = index++;
+	const size_t governments = listedGovernments.size();
+
 	// Tally the strength of a government by the strength of its present and able ships.
-	governmentRosters.clear();
+	governmentRosters.resize(governments);
+	for(auto &roster : governmentRosters)
+		roster.clear();
+	governmentStrength.assign(governments, 0);
+	Bitset able;
+	able.Resize(governments);
 	for(const auto &it : ships)
 		if(it->GetGovernment() && it->GetSystem() == playerSystem)
 		{
-			governmentRosters[it->GetGovernment()].emplace_back(it.get());
+			const unsigned government = listedGovernments.at(it->GetGovernment());
+			governmentRosters[government].emplace_back(it.get());
 			if(!it->IsDisabled() && !it->IsOverheated() && !it->IsIonized())
-				strength[it->GetGovernment()] += it->Strength();
+			{
+				governmentStrength[government] += it->Strength();
+				able.Set(government);
+			}
 		}
 
-	// Strengths of enemies and allies are rebuilt every step.
-	enemyStrength.clear();
-	allyStrength.clear();
-	for(const auto &gov : strength)
+	// Record how the governments relate to each other.
+	listedHostility.assign(governments * governments, false);
+	listedAssistance.assign(governments * governments, false);
+	ableEnemies.resize(governments);
+	for(const auto &git : listedGovernments)
 	{
-		set<const Government *> allies;
-		for(const auto &enemy : strength)
-			if(enemy.first->IsEnemy(gov.first))
-			{
-				// "Know your enemies."
-				enemyStrength[gov.first] += enemy.second;
-				for(const auto &ally : strength)
-					if(ally.first->IsEnemy(enemy.first) && !allies.contains(ally.first))
-					{
-						// "The enemy of my enemy is my friend."
-						allyStrength[gov.first] += ally.second;
-						allies.insert(ally.first);
-					}
-			}
+		Bitset &enemies = ableEnemies[git.second];
+		enemies.Clear();
+		enemies.Resize(governments);
+		for(const auto &oit : listedGovernments)
+		{
+			const bool isEnemy = git.first->IsEnemy(oit.first);
+			listedHostility[git.second * governments + oit.second] = isEnemy;
+			if(isEnemy && able.Test(oit.second))
+				enemies.Set(oit.second);
+			// If the other government's ships are not allied to this one, they
+			// will not assist this government's ships when attacked.
+			listedAssistance[git.second * governments + oit.second] = (oit.first->AttitudeToward(git.first) > 0.);
+		}
+	}
+
+	// Strengths of enemies and allies are rebuilt every step. Only governments
+	// with able ships present have any, and those only if they face an able enemy.
+	enemyStrength.assign(governments, 0);
+	allyStrength.assign(governments, 0);
+	facesEnemies.Clear();
+	facesEnemies.Resize(governments);
+	for(unsigned government = 0; government < governments; ++government)
+	{
+		const Bitset &enemies = ableEnemies[government];
+		if(!able.Test(government) || enemies.None())
+			continue;
+		facesEnemies.Set(government);
+
+		// "Know your enemies."
+		for(unsigned enemy = 0; enemy < governments; ++enemy)
+			if(enemies.Test(enemy))
+				enemyStrength[government] += governmentStrength[enemy];
+		// "The enemy of my enemy is my friend."
+		for(unsigned ally = 0; ally < governments; ++ally)
+			if(able.Test(ally) && ableEnemies[ally].Intersects(enemies))
+				allyStrength[government] += governmentStrength[ally];
 	}
 
+	// Index the listed ships by location. Each government's ships are listed
+	// in the same relative order in all the cached lists, so remember that order.
+	listedShips.clear();
+	shipGrid.Clear(-1);
+	unsigned order = 0;
+	for(unsigned government = 0; government < governments; ++government)
+		for(Ship *listed : governmentRosters[government])
+		{
+			listedShips.emplace(listed, ListedShip{order++, government});
+			shipGrid.Add(*listed);
+		}
+	shipGrid.Finish();
+
+	// If the range only covers a few grid cells compared to the number of
+	// listed ships, look up the nearby allies instead of checking every ship.
+	const double cellsAcross = 2. * ALLY_STRENGTH_RANGE / SHIP_GRID_CELL_SIZE + 2.;
+	const bool useGrid = (cellsAcross * cellsAcross < listedShips.size());
+	vector<Body *> nearby;
+
 	// Ships with nearby allies consider their allies' strength as well as their own.
 	for(const auto &it : ships)
 	{
@@ -5047,15 +5187,28 @@ void AI::UpdateStrengths(map<const Government *, int64_t> &strength, const Syste
 			continue;
 
 		int64_t &myStrength = shipStrength[it.get()];
-		for(const auto &allies : governmentRosters)
+		const size_t row = listedGovernments.at(gov) * governments;
+		auto addAlly = [&myStrength, &it](const Ship &ally) -> void
 		{
-			// If this is not an allied government, its ships will not assist this ship when attacked.
-			if(allies.first->AttitudeToward(gov) <= 0.)
-				continue;
-			for(const auto &ally : allies.second)
-				if(!ally->IsDisabled() && ally->Position().Distance(it->Position()) < 2000.)
-					myStrength += ally->Strength();
+			if(!ally.IsDisabled() && ally.Position().Distance(it->Position()) < ALLY_STRENGTH_RANGE)
+				myStrength += ally.Strength();
+		};
+		if(useGrid)
+		{
+			nearby.clear();
+			shipGrid.Circle(it->Position(), ALLY_STRENGTH_RANGE, nearby);
+			for(Body *body : nearby)
+			{
+				const Ship &ally = *static_cast<Ship *>(body);
+				if(listedAssistance[row + listedShips.at(&ally).government])
+					addAlly(ally);
+			}
 		}
+		else
+			for(unsigned government = 0; government < governments; ++government)
+				if(listedAssistance[row + government])
+					for(const Ship *ally : governmentRosters[government])
+						addAlly(*ally);
 	}
 }
 
@@ -5066,19 +5219,51 @@ void AI::CacheShipLists()
 {
 	allyLists.clear();
 	enemyLists.clear();
-	for(const auto &git : governmentRosters)
+	const size_t governments = listedGovernments.size();
+
+	for(const auto &git : listedGovernments)
 	{
 		allyLists.emplace(git.first, vector<Ship *>());
 		allyLists.at(git.first).reserve(ships.size());
 		enemyLists.emplace(git.first, vector<Ship *>());
 		enemyLists.at(git.first).reserve(ships.size());
-		for(const auto &oit : governmentRosters)
+		for(const auto &oit : listedGovernments)
 		{
-			auto &list = git.first->IsEnemy(oit.first)
-					? enemyLists[git.first] : allyLists[git.first];
-			list.insert(list.end(), oit.second.begin(), oit.second.end());
+			const vector<Ship *> &roster = governmentRosters[oit.second];
+			auto &list = listedHostility[git.second * governments + oit.second]
+				? enemyLists[git.first] : allyLists[git.first];
+			list.insert(list.end(), roster.begin(), roster.end());
 		}
 	}
+
+	maxListedSpeed = 0.;
+	minConditionScore = 0.;
+	for(const auto &roster : governmentRosters)
+		for(const Ship *listed : roster)
+		{
+			maxListedSpeed = max(maxListedSpeed, listed->Velocity().Length());
+			double conditionScore = 500. * (listed->Shields() + listed->Hull());
+			if(listed->IsOverheated())
+				conditionScore += 3000. * (listed->Heat() - .9);
+			minConditionScore = min(minConditionScore, conditionScore);
+		}
+}
+
+
+
+int AI::ListedGovernment(const Government *government) const
+{
+	const auto it = listedGovernments.find(government);
+	return (it == listedGovernments.end() ? -1 : static_cast<int>(it->second));
+}
+
+
+
+const vector<Ship *> &AI::GovernmentRoster(const Government *government) const
+{
+	static const vector<Ship *> EMPTY;
+	const int index = ListedGovernment(government);
+	return (index < 0 ? EMPTY : governmentRosters[index]);
 }
 
 
@@ -5089,24 +5274,24 @@ void AI::RegisterDerivedConditions(ConditionsStore &conditions)
 	conditions["government strength: "].ProvidePrefixed([this](const ConditionEntry &ce) -> int64_t {
 		const Government *gov = GameData::Governments().Get(ce.NameWithoutPrefix());
 		int64_t strength = 0;
-		for(const Ship *ship : governmentRosters[gov])
+		for(const Ship *ship : GovernmentRoster(gov))
 			if(ship)
 				strength += ship->Strength();
 		return strength;
 	});
 	conditions["ally strength"].ProvideNamed([this](const ConditionEntry &ce) -> int64_t {
-		return allyStrength[GameData::PlayerGovernment()];
+		return AllyStrength(GameData::PlayerGovernment());
 	});
 	conditions["enemy strength"].ProvideNamed([this](const ConditionEntry &ce) -> int64_t {
-		return enemyStrength[GameData::PlayerGovernment()];
+		return EnemyStrength(GameData::PlayerGovernment());
 	});
 	conditions["ally strength: "].ProvidePrefixed([this](const ConditionEntry &ce) -> int64_t {
 		const Government *gov = GameData::Governments().Get(ce.NameWithoutPrefix());
-		return gov ? allyStrength[gov] : 0.;
+		return gov ? AllyStrength(gov) : 0.;
 	});
 	conditions["enemy strength: "].ProvidePrefixed([this](const ConditionEntry &ce) -> int64_t {
 		const Government *gov = GameData::Governments().Get(ce.NameWithoutPrefix());
-		return gov ? enemyStrength[gov] : 0.;
+		return gov ? EnemyStrength(gov) : 0.;
 	});
 }
 
@@ -5267,8 +5452,31 @@ void AI::UpdateOrders(const Ship &ship)
 RoutePlan AI::GetRoutePlan(const Ship &ship, const System *targetSystem)
 {
 	// Note: RecacheJumpRoutes will check and reset the value for us.
-	if(player.RecacheJumpRoutes())
-		routeCache.clear();
+	if(player.RecacheJumpRoutes(changedRouteSystems))
+	{
+		routeSearches.clear();
+		if(changedRouteSystems.empty())
+		{
+			routeCache.clear();
+			routeList.clear();
+		}
+		else
+		{
+			// Only discard the routes that start from or pass through a changed system.
+			const auto IsChanged = [this](const System *system) { return changedRouteSystems.contains(system); };
+			for(auto it = routeList.begin(); it != routeList.end(); )
+			{
+				const vector<const System *> plan = it->route.Plan();
+				if(IsChanged(it->origin) || any_of(plan.begin(), plan.end(), IsChanged))
+				{
+					routeCache.erase(it->key);
+					it = routeList.erase(it);
+				}
+				else
+					++it;
+			}
+		}
+	}
 
 	size_t personalityHash = 0;
 	Hasher::Hash(personalityHash, ship.GetGovernment());
@@ -5277,25 +5485,60 @@ RoutePlan AI::GetRoutePlan(const Ship &ship, const System *targetSystem)
 
 	// A cached route that could be used for this ship could depend on the wormholes which this ship can
 	// travel through. Find the intersection of all known wormhole required attributes and the attributes
-	// which this ship satisfies.
-	vector<string> wormholeKeys;
+	// which this ship satisfies, as one bit for each requirement.
+	const auto &requirements = GameData::UniverseWormholeRequirements();
+	Bitset wormholeMask;
+	wormholeMask.Resize(requirements.size());
 	const auto &shipAttributes = ship.Attributes();
-	for(const auto &requirement : GameData::UniverseWormholeRequirements())
+	size_t index = 0;
+	for(const auto &requirement : requirements)
+	{
 		if(shipAttributes.Get(requirement))
-			wormholeKeys.emplace_back(requirement);
+			wormholeMask.Set(index);
+		++index;
+	}
 
 	auto key = RouteCacheKey(ship.JumpNavigation().Hash(), personalityHash, targetSystem,
-		player.Flagship() == &ship, wormholeKeys);
+		player.Flagship() == &ship, wormholeMask);
 
-	RoutePlan route;
 	auto it = routeCache.find(key);
-	if(it == routeCache.end())
+	if(it != routeCache.end())
 	{
-		route = RoutePlan(ship, *targetSystem, ship.IsYours() ? &player : nullptr);
-		routeCache.emplace(key, route);
+		// Mark this route as the most recently used one.
+		++routeCacheCounters.hits;
+		routeList.splice(routeList.begin(), routeList, it->second);
+		return it->second->route;
 	}
+
+	++routeCacheCounters.misses;
+	RoutePlan route;
+	if(ship.IsYours() || !ship.GetSystem())
+		route = RoutePlan(ship, *targetSystem, ship.IsYours() ? &player : nullptr);
 	else
-		route = RoutePlan(it->second);
+	{
+		// Other ships in the same system with the same capabilities continue
+		// the same search, rather than each one starting over. The player's
+		// ships do not, because their routes depend on what the player knows,
+		// which may have changed since the search was started.
+		RouteCacheKey searchKey = key;
+		searchKey.to = nullptr;
+		auto search = routeSearches.find(searchKey);
+		if(search == routeSearches.end())
+		{
+			if(routeSearches.size() >= MAX_ROUTE_SEARCHES)
+				routeSearches.clear();
+			search = routeSearches.emplace(std::move(searchKey), DistanceMap(*ship.GetSystem(), &ship)).first;
+		}
+		route = RoutePlan(search->second, *targetSystem, &ship);
+	}
+	routeList.push_front(RouteCacheEntry{key, ship.GetSystem(), route});
+	routeCache.emplace(std::move(key), routeList.begin());
+	if(routeList.size() > MAX_ROUTE_CACHE_SIZE)
+	{
+		routeCache.erase(routeList.back().key);
+		routeList.pop_back();
+		++routeCacheCounters.evictions;
+	}
 
 	return route;
 }
@@ -15,7 +15,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include "Bitset.h"
+#include "CollisionSet.h"
 #include "Command.h"
+#include "DistanceMap.h"
 #include "FireCommand.h"
 #include "FormationPositioner.h"
 #include "orders/OrderSet.h"
@@ -92,6 +95,14 @@ public:
 	// Find nearest landing location.
 	static const StellarObject *FindLandingLocation(const Ship &ship, const bool refuel = true);
 
+	// How often a cached route could be reused, for the debug overlay.
+	struct RouteCacheCounters {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+	};
+	const RouteCacheCounters &GetRouteCacheCounters() const;
+
 
 private:
 	class RouteCacheKey {
@@ -104,10 +115,10 @@ private:
 		/// @param to A pointer to the target system.
 		/// @param isPlayer Whether this key is for the player's flagship. There is special handling for the player
 		/// to avoid dangerous systems.
-		/// @param wormholeKeys A vector of attributes required to enter wormholes that this ship is capable of
-		/// entering. (See Planet::IsAccessible.)
+		/// @param wormholeMask The attributes required to enter wormholes that this ship has, as a bit for each
+		/// requirement in GameData::UniverseWormholeRequirements(). (See Planet::IsAccessible.)
 		RouteCacheKey(std::size_t jumpHash, std::size_t personalityHash, const System *to, bool isPlayer,
-			const std::vector<std::string> &wormholeKeys);
+			const Bitset &wormholeMask);
 
 		// To support use as a map key:
 		bool operator==(const RouteCacheKey &other) const;
@@ -123,7 +134,14 @@ private:
 		size_t personalityHash;
 		const System *to;
 		bool isPlayer;
-		std::vector<std::string> wormholeKeys;
+		Bitset wormholeMask;
+	};
+
+	// A cached route, and the system it starts from.
+	struct RouteCacheEntry {
+		RouteCacheKey key;
+		const System *origin;
+		RoutePlan route;
 	};
 
 
@@ -215,8 +233,12 @@ private:
 	bool Has(const Ship &ship, const Government *government, int type) const;
 
 	// Functions to classify ships based on government and system.
-	void UpdateStrengths(std::map<const Government *, int64_t> &strength, const System *playerSystem);
+	void UpdateStrengths(const System *playerSystem);
 	void CacheShipLists();
+	// Get the index of the given government in this step's flat arrays, or -1
+	// if none of its ships are in the player's system.
+	int ListedGovernment(const Government *government) const;
+	const std::vector<Ship *> &GovernmentRoster(const Government *government) const;
 
 	/// Register autoconditions that use the current AI state (ships in the system, strengths, etc.)
 	/// These conditions may be a frame behind, depending on where the conditions are queried from,
@@ -286,14 +308,48 @@ private:
 	// Records for formations flying around leadships and other objects.
 	std::map<const Body *, std::map<const FormationPattern *, FormationPositioner>> formations;
 
-	// Records that affect the combat behavior of various governments.
+	// Records that affect the combat behavior of various governments. Each
+	// government with ships in the player's system is given a dense index every
+	// step, and its roster and strengths are stored under that index.
 	std::map<const Ship *, int64_t> shipStrength;
-	std::map<const Government *, int64_t> enemyStrength;
-	std::map<const Government *, int64_t> allyStrength;
-	std::map<const Government *, std::vector<Ship *>> governmentRosters;
+	std::map<const Government *, unsigned> listedGovernments;
+	std::vector<std::vector<Ship *>> governmentRosters;
+	std::vector<int64_t> governmentStrength;
+	std::vector<int64_t> enemyStrength;
+	std::vector<int64_t> allyStrength;
+	// Which governments have any able enemies present, and for each government
+	// which of the able governments it is hostile to.
+	Bitset facesEnemies;
+	std::vector<Bitset> ableEnemies;
+	// Whether each government is hostile to each other one, and whether the
+	// ships of each government will come to the aid of each other government.
+	std::vector<bool> listedHostility;
+	std::vector<bool> listedAssistance;
 	std::map<const Government *, std::vector<Ship *>> enemyLists;
 	std::map<const Government *, std::vector<Ship *>> allyLists;
-
-	// Route planning cache:
-	std::unordered_map<RouteCacheKey, RoutePlan, RouteCacheKey::HashFunction> routeCache;
+	// A spatial index of the ships in the cached lists, so that queries limited
+	// to a range around a ship only need to examine nearby ships. For each ship
+	// it records where the ship appears in the lists and the index of the
+	// government it is listed under.
+	struct ListedShip {
+		unsigned order;
+		unsigned government;
+	};
+	CollisionSet shipGrid;
+	std::unordered_map<const Ship *, ListedShip> listedShips;
+	// The highest speed of any listed ship, and the lowest amount any listed
+	// ship's condition can lower its score in FindTarget().
+	double maxListedSpeed = 0.;
+	double minConditionScore = 0.;
+
+	// Route planning cache. The most recently used routes are at the front of
+	// the list, and the least recently used ones are evicted once it is full.
+	std::list<RouteCacheEntry> routeList;
+	std::unordered_map<RouteCacheKey, std::list<RouteCacheEntry>::iterator, RouteCacheKey::HashFunction> routeCache;
+	RouteCacheCounters routeCacheCounters;
+	// Searches for routes from a system, which are continued to find the routes
+	// to other destinations. They use the same keys, with no destination.
+	std::unordered_map<RouteCacheKey, DistanceMap, RouteCacheKey::HashFunction> routeSearches;
+	// Reusable storage for the systems whose routes need to be recalculated.
+	std::set<const System *> changedRouteSystems;
 };
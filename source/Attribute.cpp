@@ -0,0 +1,186 @@
+/* Attribute.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Attribute.h"
+
+
+
+const Dictionary::Key Attribute::ABSOLUTE_THRESHOLD("absolute threshold");
+const Dictionary::Key Attribute::ACCELERATION_MULTIPLIER("acceleration multiplier");
+const Dictionary::Key Attribute::ACCELERATION_SCAN_POWER("acceleration scan power");
+const Dictionary::Key Attribute::ACTIVE_COOLING("active cooling");
+const Dictionary::Key Attribute::AFTERBURNER_BURN("afterburner burn");
+const Dictionary::Key Attribute::AFTERBURNER_CORROSION("afterburner corrosion");
+const Dictionary::Key Attribute::AFTERBURNER_DISCHARGE("afterburner discharge");
+const Dictionary::Key Attribute::AFTERBURNER_DISRUPTION("afterburner disruption");
+const Dictionary::Key Attribute::AFTERBURNER_ENERGY("afterburner energy");
+const Dictionary::Key Attribute::AFTERBURNER_FUEL("afterburner fuel");
+const Dictionary::Key Attribute::AFTERBURNER_HEAT("afterburner heat");
+const Dictionary::Key Attribute::AFTERBURNER_HULL("afterburner hull");
+const Dictionary::Key Attribute::AFTERBURNER_ION("afterburner ion");
+const Dictionary::Key Attribute::AFTERBURNER_LEAKAGE("afterburner leakage");
+const Dictionary::Key Attribute::AFTERBURNER_SCRAMBLE("afterburner scramble");
+const Dictionary::Key Attribute::AFTERBURNER_SHIELDS("afterburner shields");
+const Dictionary::Key Attribute::AFTERBURNER_SLOWING("afterburner slowing");
+const Dictionary::Key Attribute::AFTERBURNER_THRUST("afterburner thrust");
+const Dictionary::Key Attribute::ASTEROID_SCAN_POWER("asteroid scan power");
+const Dictionary::Key Attribute::ATMOSPHERE_SCAN("atmosphere scan");
+const Dictionary::Key Attribute::AUTOMATON("automaton");
+const Dictionary::Key Attribute::BURN_RESISTANCE("burn resistance");
+const Dictionary::Key Attribute::BURN_RESISTANCE_ENERGY("burn resistance energy");
+const Dictionary::Key Attribute::BURN_RESISTANCE_FUEL("burn resistance fuel");
+const Dictionary::Key Attribute::BURN_RESISTANCE_HEAT("burn resistance heat");
+const Dictionary::Key Attribute::CARGO_SCAN_POWER("cargo scan power");
+const Dictionary::Key Attribute::CLOAK("cloak");
+const Dictionary::Key Attribute::CLOAKED_REGEN_MULTIPLIER("cloaked regen multiplier");
+const Dictionary::Key Attribute::CLOAKED_REPAIR_MULTIPLIER("cloaked repair multiplier");
+const Dictionary::Key Attribute::CLOAKING_ENERGY("cloaking energy");
+const Dictionary::Key Attribute::CLOAKING_FUEL("cloaking fuel");
+const Dictionary::Key Attribute::CLOAKING_HEAT("cloaking heat");
+const Dictionary::Key Attribute::CLOAKING_HULL("cloaking hull");
+const Dictionary::Key Attribute::CLOAKING_REPAIR_DELAY("cloaking repair delay");
+const Dictionary::Key Attribute::CLOAKING_SHIELDS("cloaking shields");
+const Dictionary::Key Attribute::CLOAKING_SHIELD_DELAY("cloaking shield delay");
+const Dictionary::Key Attribute::CLOAK_BY_MASS("cloak by mass");
+const Dictionary::Key Attribute::CLOAK_HULL_THRESHOLD("cloak hull threshold");
+const Dictionary::Key Attribute::CLOAK_PHASING("cloak phasing");
+const Dictionary::Key Attribute::COOLING("cooling");
+const Dictionary::Key Attribute::COOLING_ENERGY("cooling energy");
+const Dictionary::Key Attribute::COOLING_INEFFICIENCY("cooling inefficiency");
+const Dictionary::Key Attribute::CORROSION_RESISTANCE("corrosion resistance");
+const Dictionary::Key Attribute::CORROSION_RESISTANCE_ENERGY("corrosion resistance energy");
+const Dictionary::Key Attribute::CORROSION_RESISTANCE_FUEL("corrosion resistance fuel");
+const Dictionary::Key Attribute::CORROSION_RESISTANCE_HEAT("corrosion resistance heat");
+const Dictionary::Key Attribute::CREW_EQUIVALENT("crew equivalent");
+const Dictionary::Key Attribute::CREW_SCAN_POWER("crew scan power");
+const Dictionary::Key Attribute::DELAYED_HULL_ENERGY("delayed hull energy");
+const Dictionary::Key Attribute::DELAYED_HULL_FUEL("delayed hull fuel");
+const Dictionary::Key Attribute::DELAYED_HULL_HEAT("delayed hull heat");
+const Dictionary::Key Attribute::DELAYED_HULL_REPAIR("delayed hull repair");
+const Dictionary::Key Attribute::DELAYED_HULL_REPAIR_RATE("delayed hull repair rate");
+const Dictionary::Key Attribute::DELAYED_SHIELD_ENERGY("delayed shield energy");
+const Dictionary::Key Attribute::DELAYED_SHIELD_FUEL("delayed shield fuel");
+const Dictionary::Key Attribute::DELAYED_SHIELD_GENERATION("delayed shield generation");
+const Dictionary::Key Attribute::DELAYED_SHIELD_HEAT("delayed shield heat");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_BURNING("disabled recovery burning");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_CORROSION("disabled recovery corrosion");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_DISCHARGE("disabled recovery discharge");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_DISRUPTION("disabled recovery disruption");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_ENERGY("disabled recovery energy");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_FUEL("disabled recovery fuel");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_HEAT("disabled recovery heat");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_IONIZATION("disabled recovery ionization");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_LEAK("disabled recovery leak");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_SCRAMBLING("disabled recovery scrambling");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_SLOWING("disabled recovery slowing");
+const Dictionary::Key Attribute::DISABLED_RECOVERY_TIME("disabled recovery time");
+const Dictionary::Key Attribute::DISCHARGE_RESISTANCE("discharge resistance");
+const Dictionary::Key Attribute::DISCHARGE_RESISTANCE_ENERGY("discharge resistance energy");
+const Dictionary::Key Attribute::DISCHARGE_RESISTANCE_FUEL("discharge resistance fuel");
+const Dictionary::Key Attribute::DISCHARGE_RESISTANCE_HEAT("discharge resistance heat");
+const Dictionary::Key Attribute::DISRUPTION_RESISTANCE("disruption resistance");
+const Dictionary::Key Attribute::DISRUPTION_RESISTANCE_ENERGY("disruption resistance energy");
+const Dictionary::Key Attribute::DISRUPTION_RESISTANCE_FUEL("disruption resistance fuel");
+const Dictionary::Key Attribute::DISRUPTION_RESISTANCE_HEAT("disruption resistance heat");
+const Dictionary::Key Attribute::DRAG("drag");
+const Dictionary::Key Attribute::DRAG_REDUCTION("drag reduction");
+const Dictionary::Key Attribute::ENERGY_CAPACITY("energy capacity");
+const Dictionary::Key Attribute::ENERGY_CONSUMPTION("energy consumption");
+const Dictionary::Key Attribute::ENERGY_GENERATION("energy generation");
+const Dictionary::Key Attribute::ENERGY_SCAN_POWER("energy scan power");
+const Dictionary::Key Attribute::FUEL_CAPACITY("fuel capacity");
+const Dictionary::Key Attribute::FUEL_CONSUMPTION("fuel consumption");
+const Dictionary::Key Attribute::FUEL_ENERGY("fuel energy");
+const Dictionary::Key Attribute::FUEL_GENERATION("fuel generation");
+const Dictionary::Key Attribute::FUEL_HEAT("fuel heat");
+const Dictionary::Key Attribute::FUEL_SCAN_POWER("fuel scan power");
+const Dictionary::Key Attribute::HEAT_CAPACITY("heat capacity");
+const Dictionary::Key Attribute::HEAT_DISSIPATION("heat dissipation");
+const Dictionary::Key Attribute::HEAT_GENERATION("heat generation");
+const Dictionary::Key Attribute::HULL("hull");
+const Dictionary::Key Attribute::HULL_ENERGY("hull energy");
+const Dictionary::Key Attribute::HULL_ENERGY_MULTIPLIER("hull energy multiplier");
+const Dictionary::Key Attribute::HULL_FUEL("hull fuel");
+const Dictionary::Key Attribute::HULL_FUEL_MULTIPLIER("hull fuel multiplier");
+const Dictionary::Key Attribute::HULL_HEAT("hull heat");
+const Dictionary::Key Attribute::HULL_HEAT_MULTIPLIER("hull heat multiplier");
+const Dictionary::Key Attribute::HULL_MULTIPLIER("hull multiplier");
+const Dictionary::Key Attribute::HULL_REPAIR_MULTIPLIER("hull repair multiplier");
+const Dictionary::Key Attribute::HULL_REPAIR_RATE("hull repair rate");
+const Dictionary::Key Attribute::HULL_THRESHOLD("hull threshold");
+const Dictionary::Key Attribute::INERTIA_REDUCTION("inertia reduction");
+const Dictionary::Key Attribute::INSCRUTABLE("inscrutable");
+const Dictionary::Key Attribute::ION_RESISTANCE("ion resistance");
+const Dictionary::Key Attribute::ION_RESISTANCE_ENERGY("ion resistance energy");
+const Dictionary::Key Attribute::ION_RESISTANCE_FUEL("ion resistance fuel");
+const Dictionary::Key Attribute::ION_RESISTANCE_HEAT("ion resistance heat");
+const Dictionary::Key Attribute::JUMP_SPEED("jump speed");
+const Dictionary::Key Attribute::LEAK_RESISTANCE("leak resistance");
+const Dictionary::Key Attribute::LEAK_RESISTANCE_ENERGY("leak resistance energy");
+const Dictionary::Key Attribute::LEAK_RESISTANCE_FUEL("leak resistance fuel");
+const Dictionary::Key Attribute::LEAK_RESISTANCE_HEAT("leak resistance heat");
+const Dictionary::Key Attribute::MANEUVER_SCAN_POWER("maneuver scan power");
+const Dictionary::Key Attribute::OUTFIT_SCAN_POWER("outfit scan power");
+const Dictionary::Key Attribute::OVERHEAT_DAMAGE_RATE("overheat damage rate");
+const Dictionary::Key Attribute::OVERHEAT_DAMAGE_THRESHOLD("overheat damage threshold");
+const Dictionary::Key Attribute::RAMSCOOP("ramscoop");
+const Dictionary::Key Attribute::RANGE_FINDER_POWER("range finder power");
+const Dictionary::Key Attribute::REQUIRED_CREW("required crew");
+const Dictionary::Key Attribute::REVERSE_THRUST("reverse thrust");
+const Dictionary::Key Attribute::SCRAMBLE_RESISTANCE("scramble resistance");
+const Dictionary::Key Attribute::SCRAMBLE_RESISTANCE_ENERGY("scramble resistance energy");
+const Dictionary::Key Attribute::SCRAMBLE_RESISTANCE_FUEL("scramble resistance fuel");
+const Dictionary::Key Attribute::SCRAMBLE_RESISTANCE_HEAT("scramble resistance heat");
+const Dictionary::Key Attribute::SCRAM_DRIVE("scram drive");
+const Dictionary::Key Attribute::SHIELDS("shields");
+const Dictionary::Key Attribute::SHIELD_ENERGY("shield energy");
+const Dictionary::Key Attribute::SHIELD_ENERGY_MULTIPLIER("shield energy multiplier");
+const Dictionary::Key Attribute::SHIELD_FUEL("shield fuel");
+const Dictionary::Key Attribute::SHIELD_FUEL_MULTIPLIER("shield fuel multiplier");
+const Dictionary::Key Attribute::SHIELD_GENERATION("shield generation");
+const Dictionary::Key Attribute::SHIELD_GENERATION_MULTIPLIER("shield generation multiplier");
+const Dictionary::Key Attribute::SHIELD_HEAT("shield heat");
+const Dictionary::Key Attribute::SHIELD_HEAT_MULTIPLIER("shield heat multiplier");
+const Dictionary::Key Attribute::SHIELD_MULTIPLIER("shield multiplier");
+const Dictionary::Key Attribute::SILENT_JUMPS("silent jumps");
+const Dictionary::Key Attribute::SLOWING_RESISTANCE("slowing resistance");
+const Dictionary::Key Attribute::SLOWING_RESISTANCE_ENERGY("slowing resistance energy");
+const Dictionary::Key Attribute::SLOWING_RESISTANCE_FUEL("slowing resistance fuel");
+const Dictionary::Key Attribute::SLOWING_RESISTANCE_HEAT("slowing resistance heat");
+const Dictionary::Key Attribute::SOLAR_COLLECTION("solar collection");
+const Dictionary::Key Attribute::SOLAR_HEAT("solar heat");
+const Dictionary::Key Attribute::STRATEGIC_SCAN_POWER("strategic scan power");
+const Dictionary::Key Attribute::TACTICAL_SCAN_POWER("tactical scan power");
+const Dictionary::Key Attribute::THERMAL_SCAN_POWER("thermal scan power");
+const Dictionary::Key Attribute::THRESHOLD_PERCENTAGE("threshold percentage");
+const Dictionary::Key Attribute::THRUST("thrust");
+const Dictionary::Key Attribute::TURN("turn");
+const Dictionary::Key Attribute::TURNING_BURN("turning burn");
+const Dictionary::Key Attribute::TURNING_CORROSION("turning corrosion");
+const Dictionary::Key Attribute::TURNING_DISCHARGE("turning discharge");
+const Dictionary::Key Attribute::TURNING_DISRUPTION("turning disruption");
+const Dictionary::Key Attribute::TURNING_ENERGY("turning energy");
+const Dictionary::Key Attribute::TURNING_FUEL("turning fuel");
+const Dictionary::Key Attribute::TURNING_HEAT("turning heat");
+const Dictionary::Key Attribute::TURNING_HULL("turning hull");
+const Dictionary::Key Attribute::TURNING_ION("turning ion");
+const Dictionary::Key Attribute::TURNING_LEAKAGE("turning leakage");
+const Dictionary::Key Attribute::TURNING_SCRAMBLE("turning scramble");
+const Dictionary::Key Attribute::TURNING_SHIELDS("turning shields");
+const Dictionary::Key Attribute::TURNING_SLOWING("turning slowing");
+const Dictionary::Key Attribute::TURN_MULTIPLIER("turn multiplier");
+const Dictionary::Key Attribute::USE_CREW_EQUIVALENT_AS_CREW("use crew equivalent as crew");
+const Dictionary::Key Attribute::VELOCITY_SCAN_POWER("velocity scan power");
+const Dictionary::Key Attribute::WEAPON_SCAN_POWER("weapon scan power");
@@ -0,0 +1,194 @@
+/* Attribute.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Dictionary.h"
+
+
+
+// The ship and outfit attributes that are looked up every step, registered as
+// Dictionary keys ahead of time so that looking one up is a single array access.
+// Attributes that are only looked up occasionally can still be found by name.
+class Attribute {
+public:
+	static const Dictionary::Key ABSOLUTE_THRESHOLD;
+	static const Dictionary::Key ACCELERATION_MULTIPLIER;
+	static const Dictionary::Key ACCELERATION_SCAN_POWER;
+	static const Dictionary::Key ACTIVE_COOLING;
+	static const Dictionary::Key AFTERBURNER_BURN;
+	static const Dictionary::Key AFTERBURNER_CORROSION;
+	static const Dictionary::Key AFTERBURNER_DISCHARGE;
+	static const Dictionary::Key AFTERBURNER_DISRUPTION;
+	static const Dictionary::Key AFTERBURNER_ENERGY;
+	static const Dictionary::Key AFTERBURNER_FUEL;
+	static const Dictionary::Key AFTERBURNER_HEAT;
+	static const Dictionary::Key AFTERBURNER_HULL;
+	static const Dictionary::Key AFTERBURNER_ION;
+	static const Dictionary::Key AFTERBURNER_LEAKAGE;
+	static const Dictionary::Key AFTERBURNER_SCRAMBLE;
+	static const Dictionary::Key AFTERBURNER_SHIELDS;
+	static const Dictionary::Key AFTERBURNER_SLOWING;
+	static const Dictionary::Key AFTERBURNER_THRUST;
+	static const Dictionary::Key ASTEROID_SCAN_POWER;
+	static const Dictionary::Key ATMOSPHERE_SCAN;
+	static const Dictionary::Key AUTOMATON;
+	static const Dictionary::Key BURN_RESISTANCE;
+	static const Dictionary::Key BURN_RESISTANCE_ENERGY;
+	static const Dictionary::Key BURN_RESISTANCE_FUEL;
+	static const Dictionary::Key BURN_RESISTANCE_HEAT;
+	static const Dictionary::Key CARGO_SCAN_POWER;
+	static const Dictionary::Key CLOAK;
+	static const Dictionary::Key CLOAKED_REGEN_MULTIPLIER;
+	static const Dictionary::Key CLOAKED_REPAIR_MULTIPLIER;
+	static const Dictionary::Key CLOAKING_ENERGY;
+	static const Dictionary::Key CLOAKING_FUEL;
+	static const Dictionary::Key CLOAKING_HEAT;
+	static const Dictionary::Key CLOAKING_HULL;
+	static const Dictionary::Key CLOAKING_REPAIR_DELAY;
+	static const Dictionary::Key CLOAKING_SHIELDS;
+	static const Dictionary::Key CLOAKING_SHIELD_DELAY;
+	static const Dictionary::Key CLOAK_BY_MASS;
+	static const Dictionary::Key CLOAK_HULL_THRESHOLD;
+	static const Dictionary::Key CLOAK_PHASING;
+	static const Dictionary::Key COOLING;
+	static const Dictionary::Key COOLING_ENERGY;
+	static const Dictionary::Key COOLING_INEFFICIENCY;
+	static const Dictionary::Key CORROSION_RESISTANCE;
+	static const Dictionary::Key CORROSION_RESISTANCE_ENERGY;
+	static const Dictionary::Key CORROSION_RESISTANCE_FUEL;
+	static const Dictionary::Key CORROSION_RESISTANCE_HEAT;
+	static const Dictionary::Key CREW_EQUIVALENT;
+	static const Dictionary::Key CREW_SCAN_POWER;
+	static const Dictionary::Key DELAYED_HULL_ENERGY;
+	static const Dictionary::Key DELAYED_HULL_FUEL;
+	static const Dictionary::Key DELAYED_HULL_HEAT;
+	static const Dictionary::Key DELAYED_HULL_REPAIR;
+	static const Dictionary::Key DELAYED_HULL_REPAIR_RATE;
+	static const Dictionary::Key DELAYED_SHIELD_ENERGY;
+	static const Dictionary::Key DELAYED_SHIELD_FUEL;
+	static const Dictionary::Key DELAYED_SHIELD_GENERATION;
+	static const Dictionary::Key DELAYED_SHIELD_HEAT;
+	static const Dictionary::Key DISABLED_RECOVERY_BURNING;
+	static const Dictionary::Key DISABLED_RECOVERY_CORROSION;
+	static const Dictionary::Key DISABLED_RECOVERY_DISCHARGE;
+	static const Dictionary::Key DISABLED_RECOVERY_DISRUPTION;
+	static const Dictionary::Key DISABLED_RECOVERY_ENERGY;
+	static const Dictionary::Key DISABLED_RECOVERY_FUEL;
+	static const Dictionary::Key DISABLED_RECOVERY_HEAT;
+	static const Dictionary::Key DISABLED_RECOVERY_IONIZATION;
+	static const Dictionary::Key DISABLED_RECOVERY_LEAK;
+	static const Dictionary::Key DISABLED_RECOVERY_SCRAMBLING;
+	static const Dictionary::Key DISABLED_RECOVERY_SLOWING;
+	static const Dictionary::Key DISABLED_RECOVERY_TIME;
+	static const Dictionary::Key DISCHARGE_RESISTANCE;
+	static const Dictionary::Key DISCHARGE_RESISTANCE_ENERGY;
+	static const Dictionary::Key DISCHARGE_RESISTANCE_FUEL;
+	static const Dictionary::Key DISCHARGE_RESISTANCE_HEAT;
+	static const Dictionary::Key DISRUPTION_RESISTANCE;
+	static const Dictionary::Key DISRUPTION_RESISTANCE_ENERGY;
+	static const Dictionary::Key DISRUPTION_RESISTANCE_FUEL;
+	static const Dictionary::Key DISRUPTION_RESISTANCE_HEAT;
+	static const Dictionary::Key DRAG;
+	static const Dictionary::Key DRAG_REDUCTION;
+	static const Dictionary::Key ENERGY_CAPACITY;
+	static const Dictionary::Key ENERGY_CONSUMPTION;
+	static const Dictionary::Key ENERGY_GENERATION;
+	static const Dictionary::Key ENERGY_SCAN_POWER;
+	static const Dictionary::Key FUEL_CAPACITY;
+	static const Dictionary::Key FUEL_CONSUMPTION;
+	static const Dictionary::Key FUEL_ENERGY;
+	static const Dictionary::Key FUEL_GENERATION;
+	static const Dictionary::Key FUEL_HEAT;
+	static const Dictionary::Key FUEL_SCAN_POWER;
+	static const Dictionary::Key HEAT_CAPACITY;
+	static const Dictionary::Key HEAT_DISSIPATION;
+	static const Dictionary::Key HEAT_GENERATION;
+	static const Dictionary::Key HULL;
+	static const Dictionary::Key HULL_ENERGY;
+	static const Dictionary::Key HULL_ENERGY_MULTIPLIER;
+	static const Dictionary::Key HULL_FUEL;
+	static const Dictionary::Key HULL_FUEL_MULTIPLIER;
+	static const Dictionary::Key HULL_HEAT;
+	static const Dictionary::Key HULL_HEAT_MULTIPLIER;
+	static const Dictionary::Key HULL_MULTIPLIER;
+	static const Dictionary::Key HULL_REPAIR_MULTIPLIER;
+	static const Dictionary::Key HULL_REPAIR_RATE;
+	static const Dictionary::Key HULL_THRESHOLD;
+	static const Dictionary::Key INERTIA_REDUCTION;
+	static const Dictionary::Key INSCRUTABLE;
+	static const Dictionary::Key ION_RESISTANCE;
+	static const Dictionary::Key ION_RESISTANCE_ENERGY;
+	static const Dictionary::Key ION_RESISTANCE_FUEL;
+	static const Dictionary::Key ION_RESISTANCE_HEAT;
+	static const Dictionary::Key JUMP_SPEED;
+	static const Dictionary::Key LEAK_RESISTANCE;
+	static const Dictionary::Key LEAK_RESISTANCE_ENERGY;
+	static const Dictionary::Key LEAK_RESISTANCE_FUEL;
+	static const Dictionary::Key LEAK_RESISTANCE_HEAT;
+	static const Dictionary::Key MANEUVER_SCAN_POWER;
+	static const Dictionary::Key OUTFIT_SCAN_POWER;
+	static const Dictionary::Key OVERHEAT_DAMAGE_RATE;
+	static const Dictionary::Key OVERHEAT_DAMAGE_THRESHOLD;
+	static const Dictionary::Key RAMSCOOP;
+	static const Dictionary::Key RANGE_FINDER_POWER;
+	static const Dictionary::Key REQUIRED_CREW;
+	static const Dictionary::Key REVERSE_THRUST;
+	static const Dictionary::Key SCRAMBLE_RESISTANCE;
+	static const Dictionary::Key SCRAMBLE_RESISTANCE_ENERGY;
+	static const Dictionary::Key SCRAMBLE_RESISTANCE_FUEL;
+	static const Dictionary::Key SCRAMBLE_RESISTANCE_HEAT;
+	static const Dictionary::Key SCRAM_DRIVE;
+	static const Dictionary::Key SHIELDS;
+	static const Dictionary::Key SHIELD_ENERGY;
+	static const Dictionary::Key SHIELD_ENERGY_MULTIPLIER;
+	static const Dictionary::Key SHIELD_FUEL;
+	static const Dictionary::Key SHIELD_FUEL_MULTIPLIER;
+	static const Dictionary::Key SHIELD_GENERATION;
+	static const Dictionary::Key SHIELD_GENERATION_MULTIPLIER;
+	static const Dictionary::Key SHIELD_HEAT;
+	static const Dictionary::Key SHIELD_HEAT_MULTIPLIER;
+	static const Dictionary::Key SHIELD_MULTIPLIER;
+	static const Dictionary::Key SILENT_JUMPS;
+	static const Dictionary::Key SLOWING_RESISTANCE;
+	static const Dictionary::Key SLOWING_RESISTANCE_ENERGY;
+	static const Dictionary::Key SLOWING_RESISTANCE_FUEL;
+	static const Dictionary::Key SLOWING_RESISTANCE_HEAT;
+	static const Dictionary::Key SOLAR_COLLECTION;
+	static const Dictionary::Key SOLAR_HEAT;
+	static const Dictionary::Key STRATEGIC_SCAN_POWER;
+	static const Dictionary::Key TACTICAL_SCAN_POWER;
+	static const Dictionary::Key THERMAL_SCAN_POWER;
+	static const Dictionary::Key THRESHOLD_PERCENTAGE;
+	static const Dictionary::Key THRUST;
+	static const Dictionary::Key TURN;
+	static const Dictionary::Key TURNING_BURN;
+	static const Dictionary::Key TURNING_CORROSION;
+	static const Dictionary::Key TURNING_DISCHARGE;
+	static const Dictionary::Key TURNING_DISRUPTION;
+	static const Dictionary::Key TURNING_ENERGY;
+	static const Dictionary::Key TURNING_FUEL;
+	static const Dictionary::Key TURNING_HEAT;
+	static const Dictionary::Key TURNING_HULL;
+	static const Dictionary::Key TURNING_ION;
+	static const Dictionary::Key TURNING_LEAKAGE;
+	static const Dictionary::Key TURNING_SCRAMBLE;
+	static const Dictionary::Key TURNING_SHIELDS;
+	static const Dictionary::Key TURNING_SLOWING;
+	static const Dictionary::Key TURN_MULTIPLIER;
+	static const Dictionary::Key USE_CREW_EQUIVALENT_AS_CREW;
+	static const Dictionary::Key VELOCITY_SCAN_POWER;
+	static const Dictionary::Key WEAPON_SCAN_POWER;
+};
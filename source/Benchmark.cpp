@@ -0,0 +1,215 @@
+/* Benchmark.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+
+#include "DataFile.h"
+#include "DataNode.h"
+#include "Engine.h"
+#include "Files.h"
+#include "GameData.h"
+#include "Logger.h"
+#include "image/MaskManager.h"
+#include "NPC.h"
+#include "PlayerInfo.h"
+#include "Random.h"
+#include "Screen.h"
+#include "ShipEvent.h"
+#include "TaskQueue.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+	// The defaults for a scenario that does not specify them: one minute of
+	// game time, with an arbitrary but fixed seed.
+	const int DEFAULT_FRAMES = 3600;
+	const uint64_t DEFAULT_SEED = 1;
+
+	// The screen size determines which objects are close enough to the view
+	// to be added to the draw lists, so use a common one.
+	const int SCREEN_WIDTH = 1920;
+	const int SCREEN_HEIGHT = 1080;
+
+	void PrintRow(const string &name, chrono::steady_clock::duration time, int frames,
+		chrono::steady_clock::duration total)
+	{
+		double milliseconds = chrono::duration<double, milli>(time).count();
+		double share = total.count() ? 100. * time.count() / total.count() : 0.;
+		cout << left << setw(16) << name << right << fixed
+			<< setw(12) << setprecision(1) << milliseconds
+			<< setw(12) << setprecision(3) << milliseconds / frames
+			<< setw(8) << setprecision(1) << share << "%\n";
+	}
+}
+
+
+
+bool Benchmark::IsBenchmarkArgument(const char *const *argv)
+{
+	for(const char *const *it = argv + 1; *it; ++it)
+		if(string(*it) == "--benchmark")
+			return true;
+	return false;
+}
+
+
+
+int Benchmark::Run(const char *const *argv, PlayerInfo &player, TaskQueue &queue)
+{
+	filesystem::path path;
+	int frames = 0;
+	uint64_t seed = 0;
+	bool hasSeed = false;
+	for(const char *const *it = argv + 1; *it; ++it)
+	{
+		string arg = *it;
+		if(arg == "--benchmark" && it[1])
+			path = *++it;
+		else if(arg == "--frames" && it[1])
+			frames = atoi(*++it);
+		else if(arg == "--seed" && it[1])
+		{
+			seed = strtoull(*++it, nullptr, 10);
+			hasSeed = true;
+		}
+	}
+	if(path.empty() || !Files::Exists(path))
+	{
+		Logger::Log("Benchmark scenario \"" + path.string() + "\" not found.", Logger::Level::ERROR);
+		return 1;
+	}
+
+	// Collision detection needs the sprites' masks, so wait for all the images
+	// to be loaded. They are never uploaded, because there is no GPU to use.
+	while(GameData::GetProgress() < 1.)
+	{
+		queue.ProcessSyncTasks();
+		this_thread::yield();
+	}
+	GameData::FinishLoading();
+
+	// The scenario is a saved game, and the player ignores the benchmark node.
+	player.Load(path);
+	GameData::GetMaskManager().ScaleMasks();
+	if(!player.IsLoaded() || !player.Flagship() || !player.GetSystem())
+	{
+		Logger::Log("Benchmark scenario \"" + path.string() + "\" has no flagship in flight.",
+			Logger::Level::ERROR);
+		return 1;
+	}
+
+	string name = Files::Name(path);
+	vector<const DataNode *> npcNodes;
+	const DataFile file(path);
+	for(const DataNode &node : file)
+		if(node.Token(0) == "benchmark")
+		{
+			if(node.Size() >= 2)
+				name = node.Token(1);
+			for(const DataNode &child : node)
+			{
+				const string &key = child.Token(0);
+				bool hasValue = child.Size() >= 2;
+				if(key == "frames" && hasValue && !frames)
+					frames = child.Value(1);
+				else if(key == "seed" && hasValue && !hasSeed)
+				{
+					seed = child.Value(1);
+					hasSeed = true;
+				}
+				else if(key == "npc")
+					npcNodes.push_back(&child);
+				else
+					child.PrintTrace("Skipping unrecognized attribute:");
+			}
+		}
+	if(frames <= 0)
+		frames = DEFAULT_FRAMES;
+	if(!hasSeed)
+		seed = DEFAULT_SEED;
+
+	Screen::SetRaw(SCREEN_WIDTH, SCREEN_HEIGHT, true);
+	Random::Seed(seed);
+
+	Engine engine(player);
+	engine.Place();
+	// Add the scenario's NPCs the same way as those of a mission offered in flight.
+	list<NPC> npcs;
+	map<string, string> subs;
+	for(const DataNode *node : npcNodes)
+	{
+		NPC npc(*node, &player.Conditions(), &player.VisitedSystems(), &player.VisitedPlanets());
+		npcs.push_back(npc.Instantiate(player, subs, player.GetSystem(), player.GetSystem(), 0, 0));
+	}
+	engine.Place(npcs, player.FlagshipPtr());
+
+	// Run every step in this thread, so that the random numbers only depend on
+	// the seed. Nobody is flying the flagship, and any events are ignored.
+	Engine::StepTimes sum;
+	const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for(int frame = 0; frame < frames; ++frame)
+	{
+		engine.Go(false);
+		engine.Wait();
+		const Engine::StepTimes &times = engine.GetStepTimes();
+		sum.ai += times.ai;
+		sum.ships += times.ships;
+		sum.projectiles += times.projectiles;
+		sum.collisions += times.collisions;
+		sum.drawLists += times.drawLists;
+		sum.total += times.total;
+
+		engine.Step(false);
+		engine.Events().clear();
+	}
+	const chrono::steady_clock::duration elapsed = chrono::steady_clock::now() - start;
+
+	cout << "Benchmark \"" << name << "\": " << frames << " frames, seed " << seed << ".\n";
+	cout << left << setw(16) << "Part" << right << setw(12) << "Total (ms)"
+		<< setw(12) << "Frame (ms)" << setw(9) << "Share" << '\n';
+	PrintRow("AI", sum.ai, frames, sum.total);
+	PrintRow("Ship movement", sum.ships, frames, sum.total);
+	PrintRow("Projectiles", sum.projectiles, frames, sum.total);
+	PrintRow("Collisions", sum.collisions, frames, sum.total);
+	PrintRow("Draw lists", sum.drawLists, frames, sum.total);
+	PrintRow("Other", sum.total - sum.ai - sum.ships - sum.projectiles - sum.collisions - sum.drawLists,
+		frames, sum.total);
+	PrintRow("Step", sum.total, frames, sum.total);
+	PrintRow("Frame", elapsed, frames, sum.total);
+	cout.flush();
+
+	return 0;
+}
+
+
+
+void Benchmark::Help()
+{
+	cerr << "    --benchmark <path>: step the game in the given scenario without a window or sound,"
+		" then print how long each part of a step took." << endl;
+	cerr << "        --frames <n>: step the given number of frames instead of the scenario's default." << endl;
+	cerr << "        --seed <n>: use the given random seed instead of the scenario's default." << endl;
+}
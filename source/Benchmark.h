@@ -0,0 +1,35 @@
+/* Benchmark.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class PlayerInfo;
+class TaskQueue;
+
+
+
+// A class for timing the simulation of the game without a window, a graphics
+// context, or an audio device. A benchmark scenario is a saved game with an
+// extra "benchmark" node, which may add NPCs to the player's system. The engine
+// is stepped for a fixed number of frames with a fixed random seed, and then
+// the time taken by each part of a step is printed to the console.
+class Benchmark {
+public:
+	static bool IsBenchmarkArgument(const char *const *argv);
+	// Run the scenario given on the command line, once the game data has begun
+	// loading. Returns the program's exit code.
+	static int Run(const char *const *argv, PlayerInfo &player, TaskQueue &queue);
+	static void Help();
+};
@@ -15,6 +15,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Bitset.h"
 
+#include "Hasher.h"
+
 #include <algorithm>
 
 
@@ -122,3 +124,31 @@ void Bitset::UpdateWith(const Bitset &other)
 	for(size_t i = 0; i < size; ++i)
 		bits[i] = other.bits[i];
 }
+
+
+
+// Whether the same bits are set in both bitsets, regardless of their sizes.
+bool Bitset::operator==(const Bitset &other) const noexcept
+{
+	const auto size = min(bits.size(), other.bits.size());
+	if(!equal(bits.begin(), bits.begin() + size, other.bits.begin()))
+		return false;
+	const auto &longer = bits.size() > other.bits.size() ? bits : other.bits;
+	return all_of(longer.begin() + size, longer.end(), [](uint64_t block) { return !block; });
+}
+
+
+
+// Get a hash of the bits that are set, so that bitsets that compare equal
+// have the same hash.
+size_t Bitset::Hash() const noexcept
+{
+	// Trailing empty blocks are ignored, since they do not affect equality.
+	size_t end = bits.size();
+	while(end && !bits[end - 1])
+		--end;
+	size_t hash = 0;
+	for(size_t i = 0; i < end; ++i)
+		Hasher::Hash(hash, bits[i]);
+	return hash;
+}
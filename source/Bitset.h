@@ -51,6 +51,12 @@ public:
 	// Fills the current bitset with the bits of other.
 	void UpdateWith(const Bitset &other);
 
+	// Whether the same bits are set in both bitsets, regardless of their sizes.
+	bool operator==(const Bitset &other) const noexcept;
+	// Get a hash of the bits that are set, so that bitsets that compare equal
+	// have the same hash.
+	size_t Hash() const noexcept;
+
 
 private:
 	static constexpr size_t BITS_PER_BLOCK = std::numeric_limits<uint64_t>::digits;
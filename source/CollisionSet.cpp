@@ -23,10 +23,11 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Point.h"
 #include "Projectile.h"
 #include "Ship.h"
+#include "TaskQueue.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
-#include <numeric>
 #include <set>
 #include <string>
 
@@ -38,7 +39,9 @@ namespace {
 	// Velocity used for any projectiles with v > MAX_VELOCITY
 	constexpr int USED_MAX_VELOCITY = MAX_VELOCITY - 1;
 	// Warn the user only once about too-large projectile velocities.
-	bool warned = false;
+	atomic<bool> warned = false;
+	// Batches smaller than this are not worth handing to another thread.
+	constexpr size_t PROJECTILES_PER_BATCH = 256;
 
 	thread_local vector<bool> seen;
 }
@@ -46,8 +49,8 @@ namespace {
 
 // Initialize a collision set. The cell size and cell count should both be
 // powers of two; otherwise, they are rounded down to a power of two.
-CollisionSet::CollisionSet(unsigned cellSize, unsigned cellCount, CollisionType collisionType)
-	: collisionType(collisionType)
+CollisionSet::CollisionSet(unsigned cellSize, unsigned cellCount, CollisionType collisionType, bool incremental)
+	: collisionType(collisionType), incremental(incremental)
 {
 	// Right shift amount to convert from (x, y) location to grid (x, y).
 	SHIFT = 0u;
@@ -61,6 +64,7 @@ CollisionSet::CollisionSet(unsigned cellSize, unsigned cellCount, CollisionType
 	while(cellCount >>= 1u)
 		CELLS <<= 1;
 	WRAP_MASK = CELLS - 1u;
+	cells.resize(CELLS * CELLS);
 
 	// Just in case Clear() isn't called before objects are added:
 	Clear(0);
@@ -73,13 +77,11 @@ void CollisionSet::Clear(int step)
 {
 	this->step = step;
 
-	added.clear();
-	sorted.clear();
-	counts.clear();
-	all.clear();
-	// The counts vector starts with two sentinel slots that will be used in the
-	// course of performing the radix sort.
-	counts.resize(CELLS * CELLS + 2u, 0u);
+	// The objects and their cells are kept until Finish(), so that objects
+	// which are added again can be compared to where they were before.
+	addedCount = 0;
+	objectsChanged = !incremental;
+	moved.clear();
 }
 
 
@@ -88,25 +90,31 @@ void CollisionSet::Clear(int step)
 void CollisionSet::Add(Body &body)
 {
 	// Calculate the range of (x, y) grid coordinates this object covers.
-	int minX = static_cast<int>(body.Position().X() - body.Radius()) >> SHIFT;
-	int minY = static_cast<int>(body.Position().Y() - body.Radius()) >> SHIFT;
-	int maxX = static_cast<int>(body.Position().X() + body.Radius()) >> SHIFT;
-	int maxY = static_cast<int>(body.Position().Y() + body.Radius()) >> SHIFT;
-
-	// Add a pointer to this object in every grid cell it occupies.
-	for(int y = minY; y <= maxY; ++y)
+	const Point &position = body.Position();
+	const double radius = body.Radius();
+	CellRange range;
+	range.minX = static_cast<int>(position.X() - radius) >> SHIFT;
+	range.minY = static_cast<int>(position.Y() - radius) >> SHIFT;
+	range.maxX = static_cast<int>(position.X() + radius) >> SHIFT;
+	range.maxY = static_cast<int>(position.Y() + radius) >> SHIFT;
+
+	unsigned index = addedCount++;
+	if(index == all.size())
 	{
-		auto gy = y & WRAP_MASK;
-		for(int x = minX; x <= maxX; ++x)
-		{
-			auto gx = x & WRAP_MASK;
-			added.emplace_back(&body, all.size(), x, y);
-			++counts[gy * CELLS + gx + 2];
-		}
+		objectsChanged = true;
+		all.emplace_back(&body);
+		ranges.emplace_back(range);
+		return;
 	}
 
-	// Also save a pointer to this object irrespective of its grid location.
-	all.emplace_back(&body);
+	if(all[index] != &body)
+	{
+		objectsChanged = true;
+		all[index] = &body;
+	}
+	else if(!objectsChanged && ranges[index] != range)
+		moved.emplace_back(index, ranges[index]);
+	ranges[index] = range;
 }
 
 
@@ -114,23 +122,24 @@ void CollisionSet::Add(Body &body)
 // Finish adding objects (and organize them into the final lookup table).
 void CollisionSet::Finish()
 {
-	// Perform a partial sum to convert the counts of items in each bin into the
-	// index of the output element where that bin begins.
-	partial_sum(counts.begin(), counts.end(), counts.begin());
-
-	// Allocate space for a sorted copy of the vector.
-	sorted.resize(added.size());
-
-	// Now, perform a radix sort.
-	for(const Entry &entry : added)
+	if(addedCount != all.size())
 	{
-		auto gx = entry.x & WRAP_MASK;
-		auto gy = entry.y & WRAP_MASK;
-		auto index = gy * CELLS + gx + 1;
-
-		sorted[counts[index]++] = entry;
+		objectsChanged = true;
+		all.resize(addedCount);
+		ranges.resize(addedCount);
 	}
-	// Now, counts[index] is where a certain bin begins.
+
+	// Relocating an object is more expensive than adding it to a fresh grid,
+	// so rebuild the whole grid if a large share of the objects moved.
+	if(objectsChanged || moved.size() * 4 > all.size())
+		Rebuild();
+	else
+		for(const auto &[index, oldRange] : moved)
+		{
+			Remove(index, oldRange);
+			Insert(index, ranges[index]);
+		}
+	moved.clear();
 }
 
 
@@ -150,6 +159,77 @@ void CollisionSet::Line(const Projectile &projectile, vector<Collision> &result)
 
 
 
+// Get all possible collisions for each of the given projectiles at once. The
+// collisions of projectiles[i] are result[offsets[i]] up to result[offsets[i + 1]],
+// in exactly the order that Line() would have found them.
+void CollisionSet::Lines(const vector<Projectile> &projectiles, vector<Collision> &result,
+	vector<unsigned> &offsets) const
+{
+	result.clear();
+	offsets.assign(projectiles.size() + 1, 0u);
+	if(projectiles.empty())
+		return;
+
+	// Visit the projectiles in order of the grid cell they start in, so that
+	// consecutive queries mostly examine the same cells.
+	lineOrder.clear();
+	lineOrder.reserve(projectiles.size());
+	for(unsigned i = 0; i < projectiles.size(); ++i)
+	{
+		const Point &position = projectiles[i].Position();
+		unsigned gx = (static_cast<int>(position.X()) >> SHIFT) & WRAP_MASK;
+		unsigned gy = (static_cast<int>(position.Y()) >> SHIFT) & WRAP_MASK;
+		lineOrder.emplace_back(gy * CELLS + gx, i);
+	}
+	sort(lineOrder.begin(), lineOrder.end());
+
+	// Split the sorted projectiles into batches of neighboring cells.
+	const size_t batches = (lineOrder.size() + PROJECTILES_PER_BATCH - 1) / PROJECTILES_PER_BATCH;
+	batchResults.resize(max(batchResults.size(), batches));
+	spans.resize(projectiles.size());
+	auto runBatch = [this, &projectiles](size_t batch) -> void
+	{
+		vector<Collision> &batchResult = batchResults[batch];
+		batchResult.clear();
+		size_t end = min(lineOrder.size(), (batch + 1) * PROJECTILES_PER_BATCH);
+		for(size_t i = batch * PROJECTILES_PER_BATCH; i < end; ++i)
+		{
+			unsigned index = lineOrder[i].second;
+			unsigned begin = batchResult.size();
+			Line(projectiles[index], batchResult);
+			spans[index] = Span{static_cast<unsigned>(batch), begin, static_cast<unsigned>(batchResult.size())};
+		}
+	};
+	if(batches == 1)
+		runBatch(0);
+	else
+	{
+		// Bodies cache their mask for the most recently requested step, so make
+		// sure that cache is current before any other thread reads it.
+		for(Body *body : all)
+			body->GetMask(step);
+
+		TaskQueue queue;
+		for(size_t batch = 0; batch < batches; ++batch)
+			queue.Run([&runBatch, batch] { runBatch(batch); });
+		queue.Wait();
+		// Rethrow any exception that was raised by one of the tasks.
+		queue.ProcessSyncTasks();
+	}
+
+	// Gather the collisions into the result in the order of the projectiles.
+	for(unsigned i = 0; i < projectiles.size(); ++i)
+	{
+		const Span &span = spans[i];
+		const vector<Collision> &batchResult = batchResults[span.batch];
+		offsets[i] = result.size();
+		result.insert(result.end(), batchResult.begin() + span.begin, batchResult.begin() + span.end);
+	}
+	offsets.back() = result.size();
+}
+
+
+
 // Get all possible collisions along a line. Collisions are not necessarily sorted by
 // distance.
 void CollisionSet::Line(const Point &from, const Point &to, vector<Collision> &lineResult,
@@ -172,27 +252,25 @@ void CollisionSet::Line(const Point &from, const Point &to, vector<Collision> &l
 	{
 		// Examine all objects in the current grid cell.
 		const auto index = (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
-		vector<Entry>::const_iterator it = sorted.begin() + counts[index];
-		vector<Entry>::const_iterator end = sorted.begin() + counts[index + 1];
-		for( ; it != end; ++it)
+		for(const Entry &entry : cells[index])
 		{
 			// Skip objects that were put in this same grid cell only because
 			// of the cell coordinates wrapping around.
-			if(it->x != gx || it->y != gy)
+			if(entry.x != gx || entry.y != gy)
 				continue;
 
 			// Check if this projectile can hit this object. If either the
 			// projectile or the object has no government, it will always hit.
-			const Government *iGov = it->body->GetGovernment();
-			if(it->body != target && iGov && pGov && !iGov->IsEnemy(pGov))
+			const Government *iGov = entry.body->GetGovernment();
+			if(entry.body != target && iGov && pGov && !iGov->IsEnemy(pGov))
 				continue;
 
-			const Mask &mask = it->body->GetMask(step);
-			Point offset = from - it->body->Position();
-			const double range = mask.Collide(offset, to - from, it->body->Facing());
+			const Mask &mask = entry.body->GetMask(step);
+			Point offset = from - entry.body->Position();
+			const double range = mask.Collide(offset, to - from, entry.body->Facing());
 
 			if(range < 1.)
-				lineResult.emplace_back(it->body, collisionType, range);
+				lineResult.emplace_back(entry.body, collisionType, range);
 		}
 
 		return;
@@ -202,12 +280,9 @@ void CollisionSet::Line(const Point &from, const Point &to, vector<Collision> &l
 	if(pVelocity.Length() > MAX_VELOCITY)
 	{
 		// Cap projectile velocity to prevent integer overflows.
-		if(!warned)
-		{
+		if(!warned.exchange(true))
 			Logger::Log("A projectile exceeded the maximum allowed velocity (" + to_string(MAX_VELOCITY) + ").",
 				Logger::Level::WARNING);
-			warned = true;
-		}
 		Point newEnd = from + pVelocity.Unit() * USED_MAX_VELOCITY;
 
 		Line(from, newEnd, lineResult, pGov, target);
@@ -242,31 +317,29 @@ void CollisionSet::Line(const Point &from, const Point &to, vector<Collision> &l
 	{
 		// Examine all objects in the current grid cell.
 		auto i = (gy & WRAP_MASK) * CELLS + (gx & WRAP_MASK);
-		vector<Entry>::const_iterator it = sorted.begin() + counts[i];
-		vector<Entry>::const_iterator end = sorted.begin() + counts[i + 1];
-		for( ; it != end; ++it)
+		for(const Entry &entry : cells[i])
 		{
 			// Skip objects that were put in this same grid cell only because
 			// of the cell coordinates wrapping around.
-			if(it->x != gx || it->y != gy)
+			if(entry.x != gx || entry.y != gy)
 				continue;
 
-			if(seen[it->seenIndex])
+			if(seen[entry.seenIndex])
 				continue;
-			seen[it->seenIndex] = true;
+			seen[entry.seenIndex] = true;
 
 			// Check if this projectile can hit this object. If either the
 			// projectile or the object has no government, it will always hit.
-			const Government *iGov = it->body->GetGovernment();
-			if(it->body != target && iGov && pGov && !iGov->IsEnemy(pGov))
+			const Government *iGov = entry.body->GetGovernment();
+			if(entry.body != target && iGov && pGov && !iGov->IsEnemy(pGov))
 				continue;
 
-			const Mask &mask = it->body->GetMask(step);
-			Point offset = from - it->body->Position();
-			const double range = mask.Collide(offset, to - from, it->body->Facing());
+			const Mask &mask = entry.body->GetMask(step);
+			Point offset = from - entry.body->Position();
+			const double range = mask.Collide(offset, to - from, entry.body->Facing());
 
 			if(range < 1.)
-				lineResult.emplace_back(it->body, collisionType, range);
+				lineResult.emplace_back(entry.body, collisionType, range);
 		}
 
 		// Check if we've reached the final grid cell.
@@ -337,26 +410,23 @@ void CollisionSet::Ring(const Point &center, double inner, double outer, vector<
 		{
 			const auto gx = x & WRAP_MASK;
 			const auto index = gy * CELLS + gx;
-			vector<Entry>::const_iterator it = sorted.begin() + counts[index];
-			vector<Entry>::const_iterator end = sorted.begin() + counts[index + 1];
-
-			for( ; it != end; ++it)
+			for(const Entry &entry : cells[index])
 			{
 				// Skip objects that were put in this same grid cell only because
 				// of the cell coordinates wrapping around.
-				if(it->x != x || it->y != y)
+				if(entry.x != x || entry.y != y)
 					continue;
 
-				if(seen[it->seenIndex])
+				if(seen[entry.seenIndex])
 					continue;
-				seen[it->seenIndex] = true;
+				seen[entry.seenIndex] = true;
 
-				const Mask &mask = it->body->GetMask(step);
-				Point offset = center - it->body->Position();
+				const Mask &mask = entry.body->GetMask(step);
+				Point offset = center - entry.body->Position();
 				const double length = offset.Length();
 				if((length <= outer && length >= inner)
-					|| mask.WithinRing(offset, it->body->Facing(), inner, outer))
-					circleResult.push_back(it->body);
+					|| mask.WithinRing(offset, entry.body->Facing(), inner, outer))
+					circleResult.push_back(entry.body);
 			}
 		}
 	}
@@ -368,3 +438,75 @@ const vector<Body *> &CollisionSet::All() const
 {
 	return all;
 }
+
+
+
+// Add the grid entries of the object with the given index. Entries within each
+// cell are kept ordered by object index and then by unwrapped (y, x), which is
+// the order in which Rebuild() would add them.
+void CollisionSet::Insert(unsigned index, const CellRange &range)
+{
+	for(int y = range.minY; y <= range.maxY; ++y)
+	{
+		auto gy = y & WRAP_MASK;
+		for(int x = range.minX; x <= range.maxX; ++x)
+		{
+			auto gx = x & WRAP_MASK;
+			vector<Entry> &cell = cells[gy * CELLS + gx];
+			Entry entry(all[index], index, x, y);
+			auto it = upper_bound(cell.begin(), cell.end(), entry, [](const Entry &a, const Entry &b) -> bool
+			{
+				if(a.seenIndex != b.seenIndex)
+					return a.seenIndex < b.seenIndex;
+				return a.y != b.y ? a.y < b.y : a.x < b.x;
+			});
+			cell.insert(it, entry);
+		}
+	}
+}
+
+
+
+// Remove the grid entries of the object with the given index.
+void CollisionSet::Remove(unsigned index, const CellRange &range)
+{
+	for(int y = range.minY; y <= range.maxY; ++y)
+	{
+		auto gy = y & WRAP_MASK;
+		for(int x = range.minX; x <= range.maxX; ++x)
+		{
+			auto gx = x & WRAP_MASK;
+			vector<Entry> &cell = cells[gy * CELLS + gx];
+			auto it = find_if(cell.begin(), cell.end(), [index, x, y](const Entry &entry) -> bool
+			{
+				return entry.seenIndex == index && entry.x == x && entry.y == y;
+			});
+			if(it != cell.end())
+				cell.erase(it);
+		}
+	}
+}
+
+
+
+// Rebuild every grid cell from the objects and the cells they cover.
+void CollisionSet::Rebuild()
+{
+	for(vector<Entry> &cell : cells)
+		cell.clear();
+
+	// Add a pointer to each object in every grid cell it occupies.
+	for(unsigned index = 0; index < all.size(); ++index)
+	{
+		const CellRange &range = ranges[index];
+		for(int y = range.minY; y <= range.maxY; ++y)
+		{
+			auto gy = y & WRAP_MASK;
+			for(int x = range.minX; x <= range.maxX; ++x)
+			{
+				auto gx = x & WRAP_MASK;
+				cells[gy * CELLS + gx].emplace_back(all[index], index, x, y);
+			}
+		}
+	}
+}
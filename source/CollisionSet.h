@@ -18,6 +18,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Collision.h"
 #include "CollisionType.h"
 
+#include <utility>
 #include <vector>
 
 class Body;
@@ -30,11 +31,17 @@ class Projectile;
 // A CollisionSet allows efficient collision detection by splitting space up
 // into a grid and keeping track of which objects are in each grid cell. A check
 // for collisions can then only examine objects in certain cells.
+// In incremental mode, the set remembers which cells each object covered the
+// last time it was filled. If the same objects are added again in the same
+// order, only the objects that moved into different cells are relocated, and
+// the grid is only rebuilt from scratch when the objects or many cells change.
+// Either way, the set's contents and the order of any query's results are
+// exactly the same.
 class CollisionSet {
 public:
 	// Initialize a collision set. The cell size and cell count should both be
 	// powers of two; otherwise, they are rounded down to a power of two.
-	CollisionSet(unsigned cellSize, unsigned cellCount, CollisionType collisionType);
+	CollisionSet(unsigned cellSize, unsigned cellCount, CollisionType collisionType, bool incremental = true);
 
 	// Clear all objects in the set. Specify which engine step we are on, so we
 	// know what animation frame each object is on.
@@ -48,6 +55,12 @@ public:
 	// sorted by distance.
 	void Line(const Projectile &projectile, std::vector<Collision> &result) const;
 
+	// Get all possible collisions for each of the given projectiles at once. The
+	// collisions of projectiles[i] are result[offsets[i]] up to result[offsets[i + 1]],
+	// in exactly the order that Line() would have found them.
+	void Lines(const std::vector<Projectile> &projectiles, std::vector<Collision> &result,
+		std::vector<unsigned> &offsets) const;
+
 	// Get all possible collisions along a line. Collisions are not necessarily sorted by
 	// distance.
 	void Line(const Point &from, const Point &to, std::vector<Collision> &result,
@@ -75,6 +88,25 @@ private:
 		int y;
 	};
 
+	// The range of (x, y) grid coordinates that an object covers.
+	class CellRange {
+	public:
+		bool operator==(const CellRange &other) const = default;
+
+		int minX;
+		int minY;
+		int maxX;
+		int maxY;
+	};
+
+
+private:
+	// Add or remove the grid entries of the object with the given index.
+	void Insert(unsigned index, const CellRange &range);
+	void Remove(unsigned index, const CellRange &range);
+	// Rebuild every grid cell from the objects and the cells they cover.
+	void Rebuild();
+
 
 private:
 	// The type of collisions this CollisionSet is responsible for.
@@ -92,10 +124,32 @@ private:
 	// The current game engine step.
 	int step;
 
-	// Vectors to store the objects in the collision set.
+	// Whether to only relocate objects that moved, rather than rebuilding the grid.
+	bool incremental;
+	// The number of objects added since the set was last cleared.
+	unsigned addedCount = 0;
+	// Whether the objects added so far differ from the objects in the grid.
+	bool objectsChanged = true;
+	// The objects whose cells changed since the grid was last updated, with
+	// the range of cells they used to cover.
+	std::vector<std::pair<unsigned, CellRange>> moved;
+
+	// Vectors to store the objects in the collision set, and the range of grid
+	// cells that each of those objects covers.
 	std::vector<Body *> all;
-	std::vector<Entry> added;
-	std::vector<Entry> sorted;
-	// After Finish(), counts[index] is where a certain bin begins.
-	std::vector<unsigned> counts;
+	std::vector<CellRange> ranges;
+	// The entries in each grid cell, ordered by the index of their object.
+	std::vector<std::vector<Entry>> cells;
+
+	// Scratch space for Lines(), kept between calls to avoid reallocating it.
+	// Each batch of projectiles stores its collisions in its own buffer, and
+	// spans[i] records which batch and which part of it hold projectile i's.
+	struct Span {
+		unsigned batch;
+		unsigned begin;
+		unsigned end;
+	};
+	mutable std::vector<std::pair<unsigned, unsigned>> lineOrder;
+	mutable std::vector<std::vector<Collision>> batchResults;
+	mutable std::vector<Span> spans;
 };
@@ -201,6 +201,7 @@ void ConditionAssignments::Add(const DataNode &node, const ConditionsStore *cond
 
 		// Perform optimization of the parsed expression.
 		expr.Optimize(node);
+		expr.Compile();
 
 		// Add the assignment when all parsing succeeded.
 		assignments.emplace_back(key, ao, expr);
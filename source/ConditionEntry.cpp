@@ -15,6 +15,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "ConditionEntry.h"
 
+#include "ConditionsStore.h"
 
 using namespace std;
 
@@ -129,6 +130,7 @@ void ConditionEntry::ProvidePrefixed(function<int64_t(const ConditionEntry &)> g
 {
 	this->getFunction = std::move(getFunction);
 	this->providingEntry = this;
+	ConditionsStore::Invalidate();
 }
 
 
@@ -146,6 +148,7 @@ void ConditionEntry::ProvideNamed(function<int64_t(const ConditionEntry &)> getF
 {
 	this->getFunction = std::move(getFunction);
 	this->providingEntry = nullptr;
+	ConditionsStore::Invalidate();
 }
 
 
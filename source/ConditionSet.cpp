@@ -15,6 +15,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "ConditionSet.h"
 
+#include "ConditionEntry.h"
 #include "ConditionsStore.h"
 #include "DataNode.h"
 #include "DataWriter.h"
@@ -92,6 +93,10 @@ namespace
 	};
 
 
+	/// The deepest stack of values that a compiled program may need.
+	constexpr size_t MAX_PROGRAM_STACK = 64;
+
+
 	/// Get the precedence of an operator.
 	int Precedence(const ConditionSet::ExpressionOp op)
 	{
@@ -145,6 +150,202 @@ namespace
 
 
 
+// A condition set compiled into a flat list of instructions for a stack machine,
+// in which each condition is read directly from the entry that provides it.
+// The entries are looked up again whenever the ConditionsStore's revision
+// changes, i.e. only after conditions were added or started to be provided.
+class ConditionSet::Program {
+public:
+	// Compile the given expression. Returns false if it cannot be compiled.
+	bool Compile(const ConditionSet &set);
+
+	int64_t Run() const;
+
+
+private:
+	enum class Code {
+		LITERAL, ///< Push the literal value.
+		VARIABLE, ///< Push the value of the condition in the given slot.
+		ACCUMULATE, ///< Pop a value and combine it into the value below it.
+		AND_FIRST, ///< Jump to the target if the value on top is zero.
+		AND_NEXT, ///< Pop a value; if it is zero, replace the value on top with zero and jump to the target.
+		OR_NEXT, ///< Jump to the target if the value on top is non-zero, otherwise pop it.
+	};
+
+	struct Instruction {
+		Code code;
+		// The slot of a VARIABLE or the jump target of AND and OR instructions.
+		size_t argument = 0;
+		int64_t value = 0;
+		BinFun op = nullptr;
+	};
+
+	// A condition read by the program, and where its value was last found.
+	struct Slot {
+		explicit Slot(const string &name) : name(name), accessor(make_unique<ConditionEntry>(name)) {}
+
+		string name;
+		const ConditionEntry *entry = nullptr;
+		// For reading conditions from prefixed providers.
+		unique_ptr<ConditionEntry> accessor;
+	};
+
+
+private:
+	bool Add(const ConditionSet &set, size_t depth);
+	void Resolve() const;
+
+
+private:
+	const ConditionsStore *conditions = nullptr;
+	vector<Instruction> code;
+	mutable vector<Slot> slots;
+	mutable uint64_t revision = 0;
+	// Whether the slots have been resolved at least once.
+	mutable bool isResolved = false;
+};
+
+
+
+bool ConditionSet::Program::Compile(const ConditionSet &set)
+{
+	conditions = set.conditions;
+	return Add(set, 0);
+}
+
+
+
+int64_t ConditionSet::Program::Run() const
+{
+	if(!isResolved || revision != ConditionsStore::Revision())
+		Resolve();
+
+	int64_t stack[MAX_PROGRAM_STACK];
+	size_t top = 0;
+	for(size_t i = 0; i < code.size(); ++i)
+	{
+		const Instruction &instruction = code[i];
+		switch(instruction.code)
+		{
+			case Code::LITERAL:
+				stack[top++] = instruction.value;
+				break;
+			case Code::VARIABLE:
+			{
+				const ConditionEntry *entry = slots[instruction.argument].entry;
+				stack[top++] = entry ? static_cast<int64_t>(*entry) : 0;
+				break;
+			}
+			case Code::ACCUMULATE:
+				--top;
+				stack[top - 1] = instruction.op(stack[top - 1], stack[top]);
+				break;
+			case Code::AND_FIRST:
+				if(!stack[top - 1])
+					i = instruction.argument - 1;
+				break;
+			case Code::AND_NEXT:
+				if(!stack[--top])
+				{
+					stack[top - 1] = 0;
+					i = instruction.argument - 1;
+				}
+				break;
+			case Code::OR_NEXT:
+				if(stack[top - 1])
+					i = instruction.argument - 1;
+				else
+					--top;
+				break;
+		}
+	}
+	return stack[0];
+}
+
+
+
+// Append the instructions for the given expression, which will be evaluated
+// with the given number of values already on the stack.
+bool ConditionSet::Program::Add(const ConditionSet &set, size_t depth)
+{
+	if(depth + 2 > MAX_PROGRAM_STACK)
+		return false;
+
+	const auto &children = set.children;
+	const auto PushLiteral = [this](int64_t value)
+	{
+		code.push_back(Instruction{Code::LITERAL, 0, value});
+		return true;
+	};
+	// Add all the children, followed by the given instruction after all but the last (or first) of them. Jumps
+	// go to the end of this expression.
+	const auto AddChildren = [this, &children, depth](Code between, Code first)
+	{
+		vector<size_t> jumps;
+		for(size_t i = 0; i < children.size(); ++i)
+		{
+			if(!Add(children[i], depth + (i && between != Code::OR_NEXT)))
+				return false;
+			if(i + 1 == children.size() && between == Code::OR_NEXT)
+				break;
+			jumps.push_back(code.size());
+			code.push_back(Instruction{i ? between : first});
+		}
+		for(size_t jump : jumps)
+			code[jump].argument = code.size();
+		return true;
+	};
+
+	switch(set.expressionOperator)
+	{
+		case ExpressionOp::VAR:
+			// Evaluating a condition without a store is an error, which is reported when walking the tree.
+			if(!conditions)
+				return false;
+			code.push_back(Instruction{Code::VARIABLE, slots.size()});
+			slots.emplace_back(set.conditionName);
+			return true;
+		case ExpressionOp::LIT:
+			return PushLiteral(set.literal);
+		case ExpressionOp::AND:
+			// An empty AND section returns true.
+			if(children.empty())
+				return PushLiteral(1);
+			return AddChildren(Code::AND_NEXT, Code::AND_FIRST);
+		case ExpressionOp::OR:
+			if(children.empty())
+				return PushLiteral(0);
+			return AddChildren(Code::OR_NEXT, Code::OR_NEXT);
+		default:
+			break;
+	}
+
+	BinFun accumulatorOp = Op(set.expressionOperator);
+	if(accumulatorOp == nullptr || children.empty())
+		return PushLiteral(0);
+
+	for(size_t i = 0; i < children.size(); ++i)
+	{
+		if(!Add(children[i], depth + (i > 0)))
+			return false;
+		if(i)
+			code.push_back(Instruction{Code::ACCUMULATE, 0, 0, accumulatorOp});
+	}
+	return true;
+}
+
+
+
+void ConditionSet::Program::Resolve() const
+{
+	revision = ConditionsStore::Revision();
+	isResolved = true;
+	for(Slot &slot : slots)
+		slot.entry = conditions->Find(slot.name, *slot.accessor);
+}
+
+
+
 ConditionSet::ConditionSet(const ConditionsStore *conditions)
 {
 	this->conditions = conditions;
@@ -187,6 +388,7 @@ ConditionSet &ConditionSet::operator=(const ConditionSet &&other) noexcept
 	conditionName = std::move(other.conditionName);
 	children = std::move(other.children);
 	conditions = other.conditions;
+	program = other.program;
 
 	return *this;
 }
@@ -210,6 +412,7 @@ ConditionSet &ConditionSet::operator=(const ConditionSet &other)
 	conditionName = other.conditionName;
 	children = other.children;
 	conditions = other.conditions;
+	program = other.program;
 
 	return *this;
 }
@@ -226,6 +429,7 @@ void ConditionSet::Load(const DataNode &node, const ConditionsStore *conditions)
 	// The top-node is always an 'and' node, without the keyword.
 	expressionOperator = ExpressionOp::AND;
 	ParseChildren(node);
+	Compile();
 }
 
 
@@ -350,6 +554,7 @@ void ConditionSet::MakeNever()
 	children.clear();
 	expressionOperator = ExpressionOp::LIT;
 	literal = 0;
+	program.reset();
 }
 
 
@@ -383,6 +588,28 @@ bool ConditionSet::Test() const
 
 
 int64_t ConditionSet::Evaluate() const
+{
+	return program ? program->Run() : EvaluateTree();
+}
+
+
+
+set<string> ConditionSet::RelevantConditions() const
+{
+	set<string> result;
+	// Add the name from this set, if it is a VAR type operator.
+	if(expressionOperator == ExpressionOp::VAR)
+		result.emplace(conditionName);
+	// Add the names from the children.
+	for(const auto &child : children)
+		for(const auto &rc : child.RelevantConditions())
+			result.emplace(rc);
+	return result;
+}
+
+
+
+int64_t ConditionSet::EvaluateTree() const
 {
 	switch(expressionOperator)
 	{
@@ -404,7 +631,7 @@ int64_t ConditionSet::Evaluate() const
 			int64_t result = 0;
 			for(const ConditionSet &child : children)
 			{
-				int64_t childResult = child.Evaluate();
+				int64_t childResult = child.EvaluateTree();
 				if(!childResult)
 					return 0;
 				// Assign the first non-zero result to the result variable.
@@ -416,7 +643,7 @@ int64_t ConditionSet::Evaluate() const
 		case ExpressionOp::OR:
 			for(const ConditionSet &child : children)
 			{
-				int64_t childResult = child.Evaluate();
+				int64_t childResult = child.EvaluateTree();
 				// Return the first non-zero result.
 				if(childResult)
 					return childResult;
@@ -430,9 +657,9 @@ int64_t ConditionSet::Evaluate() const
 	// MAX and MIN are also handled by the accumulator.
 	BinFun accumulatorOp = Op(expressionOperator);
 	if(accumulatorOp != nullptr && !children.empty())
-		return accumulate(next(children.begin()), children.end(), children[0].Evaluate(),
+		return accumulate(next(children.begin()), children.end(), children[0].EvaluateTree(),
 			[&accumulatorOp](int64_t accumulated, const ConditionSet &b) -> int64_t {
-				return accumulatorOp(accumulated, b.Evaluate());
+				return accumulatorOp(accumulated, b.EvaluateTree());
 		});
 
 	// If we don't have an accumulator function, or no children, then return the default value.
@@ -441,17 +668,13 @@ int64_t ConditionSet::Evaluate() const
 
 
 
-set<string> ConditionSet::RelevantConditions() const
+void ConditionSet::Compile()
 {
-	set<string> result;
-	// Add the name from this set, if it is a VAR type operator.
-	if(expressionOperator == ExpressionOp::VAR)
-		result.emplace(conditionName);
-	// Add the names from the children.
-	for(const auto &child : children)
-		for(const auto &rc : child.RelevantConditions())
-			result.emplace(rc);
-	return result;
+	auto compiled = make_shared<Program>();
+	if(compiled->Compile(*this))
+		program = std::move(compiled);
+	else
+		program.reset();
 }
 
 
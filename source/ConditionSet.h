@@ -17,6 +17,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -116,6 +117,13 @@ public:
 
 
 private:
+	/// Evaluate this expression by walking its tree of sub-expressions.
+	int64_t EvaluateTree() const;
+
+	/// Compile this expression into a program for faster evaluation, if possible. Must be called again whenever the
+	/// expression is changed.
+	void Compile();
+
 	/// Parse a node completely into this expression; all tokens on the line and all children if there are any.
 	bool ParseFromStart(const DataNode &node);
 
@@ -191,6 +199,12 @@ private:
 	/// Nested sets of conditions to be tested.
 	std::vector<ConditionSet> children;
 
+	/// This expression compiled into a flat list of instructions, which read the conditions directly from their
+	/// entries in the ConditionsStore. Copies of this set share the same program. If there is no program, the
+	/// expression is evaluated from the tree instead.
+	class Program;
+	std::shared_ptr<const Program> program;
+
 	// Let the assignment class call internal functions and parsers.
 	friend class ConditionAssignments;
 };
@@ -20,10 +20,15 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "DataWriter.h"
 #include "Logger.h"
 
+#include <atomic>
 #include <utility>
 
 using namespace std;
 
+namespace {
+	atomic<uint64_t> revision = 0;
+}
+
 
 
 // Constructor with loading primary conditions from datanode.
@@ -52,6 +57,22 @@ ConditionsStore::ConditionsStore(const map<string, int64_t> &initialConditions)
 
 
 
+ConditionsStore &ConditionsStore::operator=(ConditionsStore &&other)
+{
+	storage = std::move(other.storage);
+	Invalidate();
+	return *this;
+}
+
+
+
+ConditionsStore::~ConditionsStore()
+{
+	Invalidate();
+}
+
+
+
 void ConditionsStore::Load(const DataNode &node)
 {
 	for(const DataNode &child : node)
@@ -140,6 +161,7 @@ ConditionEntry &ConditionsStore::operator[](const string &name)
 	// Create the entry (name is used as key, and as ConditionEntry constructor argument.
 	auto emp = storage.emplace(make_pair(name, name));
 	it = emp.first;
+	Invalidate();
 
 	// If a relevant prefix provider is found, then provision this entry with the provider.
 	if(ceprov != nullptr)
@@ -151,6 +173,26 @@ ConditionEntry &ConditionsStore::operator[](const string &name)
 
 
 
+const ConditionEntry *ConditionsStore::Find(const string &name, ConditionEntry &accessor) const
+{
+	const ConditionEntry *ce = GetEntry(name);
+	if(!ce || ce->name == name)
+		return ce;
+
+	// Like Get(), read from a prefixed provider through an entry that is not in the store.
+	accessor.providingEntry = ce;
+	return &accessor;
+}
+
+
+
+uint64_t ConditionsStore::Revision()
+{
+	return revision.load(memory_order_acquire);
+}
+
+
+
 int64_t ConditionsStore::PrimariesSize() const
 {
 	int64_t result = 0;
@@ -197,3 +239,10 @@ const ConditionEntry *ConditionsStore::GetEntry(const string &name) const
 	// And otherwise we don't have a match.
 	return nullptr;
 }
+
+
+
+void ConditionsStore::Invalidate()
+{
+	revision.fetch_add(1, memory_order_release);
+}
@@ -48,7 +48,8 @@ public:
 	ConditionsStore(const ConditionsStore &) = delete;
 	ConditionsStore &operator=(const ConditionsStore &) = delete;
 	ConditionsStore(ConditionsStore &&) = delete;
-	ConditionsStore &operator=(ConditionsStore &&) = default;
+	ConditionsStore &operator=(ConditionsStore &&other);
+	~ConditionsStore();
 
 	// Serialization support for this class.
 	void Load(const DataNode &node);
@@ -67,6 +68,15 @@ public:
 	/// Direct access to a specific condition (using the ConditionEntry as proxy).
 	ConditionEntry &operator[](const std::string &name);
 
+	/// Find the entry that provides the given condition, so that its value can be read repeatedly without looking it
+	/// up again. A condition from a prefixed provider that has no entry of its own is read through the given accessor,
+	/// which must have the condition's name. Returns nullptr if nothing provides the condition (so its value is 0).
+	/// The result stays valid for as long as Revision() does not change.
+	const ConditionEntry *Find(const std::string &name, ConditionEntry &accessor) const;
+	/// Get a number that changes whenever an entry is added to or removed from any store, or starts to provide
+	/// conditions, since that may change which entry provides a condition.
+	static uint64_t Revision();
+
 	// Helper for testing; check how many primary conditions are registered.
 	int64_t PrimariesSize() const;
 
@@ -78,8 +88,14 @@ private:
 	ConditionEntry *GetEntry(const std::string &name);
 	const ConditionEntry *GetEntry(const std::string &name) const;
 
+	// Note that the entries that provide conditions may have changed.
+	static void Invalidate();
+
 
 private:
 	// Storage for both the primary conditions as well as the providers.
 	std::map<std::string, ConditionEntry> storage;
+
+	// Entries invalidate the lookups of other conditions when they become providers.
+	friend ConditionEntry;
 };
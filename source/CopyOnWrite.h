@@ -0,0 +1,68 @@
+/* CopyOnWrite.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+
+
+
+// A value that is shared between all copies of it until one of them needs to
+// change it, at which point that copy gets its own copy of the value. This is
+// for data that is expensive to copy but rarely changes after it is loaded,
+// e.g. the outfits of all the ships that are created from the same model.
+template<class Type>
+class CopyOnWrite {
+public:
+	const Type *operator->() const noexcept { return &**this; }
+	const Type &operator*() const noexcept { return data ? *data : Empty(); }
+
+	// Get the value in order to change it. If it is shared with any other
+	// copies, it is copied first. Because of that, this must not be called
+	// while another thread may be copying this object.
+	Type &Mutable();
+
+	// Check whether this value is shared with other copies of it.
+	bool IsShared() const noexcept { return data.use_count() > 1; }
+
+
+private:
+	static const Type &Empty();
+
+
+private:
+	std::shared_ptr<Type> data;
+};
+
+
+
+template<class Type>
+Type &CopyOnWrite<Type>::Mutable()
+{
+	if(!data)
+		data = std::make_shared<Type>();
+	else if(data.use_count() > 1)
+		data = std::make_shared<Type>(*data);
+	return *data;
+}
+
+
+
+template<class Type>
+const Type &CopyOnWrite<Type>::Empty()
+{
+	static const Type empty;
+	return empty;
+}
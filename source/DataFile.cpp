@@ -18,8 +18,30 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Files.h"
 #include "text/Utf8.h"
 
+#include <algorithm>
+#include <iterator>
+
 using namespace std;
 
+namespace {
+	// The parent index of nodes at the top level of the file.
+	constexpr size_t ROOT = static_cast<size_t>(-1);
+
+	// A line of the file that produces a node.
+	struct Line {
+		size_t parent;
+		size_t lineNumber;
+		size_t firstToken;
+		size_t children = 0;
+	};
+
+	// A warning about the node produced by the given line.
+	struct Warning {
+		size_t node;
+		string message;
+	};
+}
+
 
 
 // Constructor, taking a file path (in UTF-8).
@@ -81,7 +103,7 @@ void DataFile::Load(istream &in)
 
 
 // Get an iterator to the start of the list of nodes in this file.
-list<DataNode>::const_iterator DataFile::begin() const
+vector<DataNode>::const_iterator DataFile::begin() const
 {
 	return root.begin();
 }
@@ -89,20 +111,34 @@ list<DataNode>::const_iterator DataFile::begin() const
 
 
 // Get an iterator to the end of the list of nodes in this file.
-list<DataNode>::const_iterator DataFile::end() const
+vector<DataNode>::const_iterator DataFile::end() const
 {
 	return root.end();
 }
 
 
 
-// Parse the given text.
+// Parse the given text. The file is tokenized first, so that each node's tokens
+// and children can then be stored in containers of exactly the right size.
 void DataFile::LoadData(const string &data)
 {
+	// Every line that produces a node, in the order they appear in the file.
+	vector<Line> lines;
+	// The tokens of every node, stored contiguously in the same order.
+	vector<string> tokens;
+	// Warnings are printed once the tree is built, since they include a trace
+	// of the nodes in question.
+	vector<Warning> warnings;
+	size_t rootChildren = 0;
+	// Every node is on its own line, and most have only a few tokens.
+	const size_t lineCount = count(data.begin(), data.end(), '\n');
+	lines.reserve(lineCount);
+	tokens.reserve(2 * lineCount);
+
 	// Keep track of the current stack of indentation levels and the most recent
 	// node at each level - that is, the node that will be the "parent" of any
 	// new node added at the next deeper indentation level.
-	vector<DataNode *> stack(1, &root);
+	vector<size_t> stack(1, ROOT);
 	vector<int> separatorStack(1, -1);
 	bool fileIsTabs = false;
 	bool fileIsSpaces = false;
@@ -147,7 +183,7 @@ void DataFile::LoadData(const string &data)
 		if(c == '#')
 		{
 			if(mixedIndentation)
-				root.PrintTrace("Mixed whitespace usage for comment at line " + to_string(lineNumber));
+				warnings.push_back({ROOT, "Mixed whitespace usage for comment at line " + to_string(lineNumber)});
 			while(c != '\n')
 				c = Utf8::DecodeCodePoint(data, pos);
 		}
@@ -164,13 +200,13 @@ void DataFile::LoadData(const string &data)
 		}
 
 		// Add this node as a child of the proper node.
-		list<DataNode> &children = stack.back()->children;
-		children.emplace_back(stack.back());
-		DataNode &node = children.back();
-		node.lineNumber = lineNumber;
+		const size_t parent = stack.back();
+		++(parent == ROOT ? rootChildren : lines[parent].children);
+		const size_t index = lines.size();
+		lines.push_back({parent, lineNumber, tokens.size()});
 
 		// Remember where in the tree we are.
-		stack.push_back(&node);
+		stack.push_back(index);
 		separatorStack.push_back(separators);
 
 		// Tokenize the line. Skip comments and empty lines.
@@ -199,12 +235,12 @@ void DataFile::LoadData(const string &data)
 			// range, but it appears that some libraries do not handle that case
 			// correctly. So:
 			if(tokenPos == endPos)
-				node.tokens.emplace_back();
+				tokens.emplace_back();
 			else
-				node.tokens.emplace_back(data, tokenPos, endPos - tokenPos);
+				tokens.emplace_back(data, tokenPos, endPos - tokenPos);
 			// This is not a fatal error, but it may indicate a format mistake:
 			if(isQuoted && c == '\n')
-				node.PrintTrace("Closing quotation mark is missing:");
+				warnings.push_back({index, "Closing quotation mark is missing:"});
 
 			if(c != '\n')
 			{
@@ -230,11 +266,32 @@ void DataFile::LoadData(const string &data)
 				}
 			}
 		}
-		// Now that we've reached the end of the line, we know no more tokens will be added to the node.
-		node.tokens.shrink_to_fit();
 
-		// Now that we've tokenized this node, print any mixed whitespace warnings.
+		// Now that we've tokenized this node, note any mixed whitespace warnings.
 		if(mixedIndentation)
-			node.PrintTrace("Mixed whitespace usage at line");
+			warnings.push_back({index, "Mixed whitespace usage at line"});
 	}
+
+	// Build the tree. Each node's children are reserved before the first one is
+	// added, so the nodes never move once they have been created.
+	vector<DataNode *> nodes;
+	nodes.reserve(lines.size());
+	root.children.reserve(rootChildren);
+	for(size_t i = 0; i < lines.size(); ++i)
+	{
+		const Line &line = lines[i];
+		DataNode &parent = (line.parent == ROOT ? root : *nodes[line.parent]);
+		const size_t lastToken = (i + 1 < lines.size() ? lines[i + 1].firstToken : tokens.size());
+		vector<string> nodeTokens(make_move_iterator(tokens.begin() + line.firstToken),
+			make_move_iterator(tokens.begin() + lastToken));
+
+		parent.children.push_back(DataNode(std::move(nodeTokens), line.lineNumber));
+		DataNode &node = parent.children.back();
+		node.parent = &parent;
+		node.children.reserve(line.children);
+		nodes.push_back(&node);
+	}
+
+	for(const Warning &warning : warnings)
+		(warning.node == ROOT ? root : *nodes[warning.node]).PrintTrace(warning.message);
 }
@@ -19,7 +19,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <filesystem>
 #include <istream>
-#include <list>
+#include <vector>
 #include <string>
 
 
@@ -41,8 +41,8 @@ public:
 	void Load(std::istream &in);
 
 	// Functions for iterating through all DataNodes in this file.
-	std::list<DataNode>::const_iterator begin() const;
-	std::list<DataNode>::const_iterator end() const;
+	std::vector<DataNode>::const_iterator begin() const;
+	std::vector<DataNode>::const_iterator end() const;
 
 
 private:
@@ -38,6 +38,14 @@ DataNode::DataNode(const DataNode *parent) noexcept(false)
 
 
 
+// Construct a DataNode with its final tokens.
+DataNode::DataNode(vector<string> &&tokens, size_t lineNumber) noexcept
+	: tokens(std::move(tokens)), lineNumber(lineNumber)
+{
+}
+
+
+
 // Copy constructor.
 DataNode::DataNode(const DataNode &other)
 	: children(other.children), tokens(other.tokens), lineNumber(std::move(other.lineNumber))
@@ -298,6 +306,10 @@ bool DataNode::IsConditionName(const string &token)
 void DataNode::AddChild(const DataNode &child)
 {
 	children.emplace_back(child);
+	// Adding the child may have moved the others, which does not preserve
+	// their parent pointers.
+	for(DataNode &it : children)
+		it.parent = this;
 }
 
 
@@ -311,7 +323,7 @@ bool DataNode::HasChildren() const noexcept
 
 
 // Iterator to the beginning of the list of children.
-list<DataNode>::const_iterator DataNode::begin() const noexcept
+vector<DataNode>::const_iterator DataNode::begin() const noexcept
 {
 	return children.begin();
 }
@@ -319,7 +331,7 @@ list<DataNode>::const_iterator DataNode::begin() const noexcept
 
 
 // Iterator to the end of the list of children.
-list<DataNode>::const_iterator DataNode::end() const noexcept
+vector<DataNode>::const_iterator DataNode::end() const noexcept
 {
 	return children.end();
 }
@@ -16,7 +16,6 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <cstdint>
-#include <list>
 #include <string>
 #include <vector>
 
@@ -72,21 +71,26 @@ public:
 	// Check if this node has any children. If so, the iterator functions below
 	// can be used to access them.
 	bool HasChildren() const noexcept;
-	std::list<DataNode>::const_iterator begin() const noexcept;
-	std::list<DataNode>::const_iterator end() const noexcept;
+	std::vector<DataNode>::const_iterator begin() const noexcept;
+	std::vector<DataNode>::const_iterator end() const noexcept;
 
 	// Print a message followed by a "trace" of this node and its parents.
 	int PrintTrace(const std::string &message = "") const;
 
 
 private:
+	// Construct a node with the given tokens, without reserving any space for
+	// more. This is used by DataFile, which knows every node's final contents.
+	DataNode(std::vector<std::string> &&tokens, size_t lineNumber) noexcept;
+
 	// Adjust the parent pointers when a copy is made of a DataNode.
 	void Reparent() noexcept;
 
 
 private:
 	// These are "child" nodes found on subsequent lines with deeper indentation.
-	std::list<DataNode> children;
+	// They are stored contiguously, so adding a child may move the others.
+	std::vector<DataNode> children;
 	// These are the tokens found in this particular line of the data file.
 	std::vector<std::string> tokens;
 	// The parent pointer is used only for printing stack traces.
@@ -18,13 +18,54 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "StringInterner.h"
 
 #include <cstring>
+#include <limits>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 using namespace std;
 
 namespace {
+	// The index of an element that has no registered key.
+	constexpr uint32_t NO_KEY = numeric_limits<uint32_t>::max();
+
+	// The index of each registered key, by its interned name.
+	unordered_map<const char *, uint32_t> &RegisteredKeys()
+	{
+		static unordered_map<const char *, uint32_t> keys;
+		return keys;
+	}
+	shared_mutex &RegisteredKeysMutex()
+	{
+		static shared_mutex registeredKeysMutex;
+		return registeredKeysMutex;
+	}
+
+	// Register the given interned name, if it is not already, and return its index.
+	uint32_t RegisterKey(const char *name)
+	{
+		unique_lock lock(RegisteredKeysMutex());
+		auto &keys = RegisteredKeys();
+		return keys.emplace(name, keys.size()).first->second;
+	}
+
+	// Get the index of the registered key with the given interned name, if there is one.
+	uint32_t FindKey(const char *name)
+	{
+		shared_lock lock(RegisteredKeysMutex());
+		const auto &keys = RegisteredKeys();
+		auto it = keys.find(name);
+		return it == keys.end() ? NO_KEY : it->second;
+	}
+
+	uint32_t RegisteredKeyCount()
+	{
+		shared_lock lock(RegisteredKeysMutex());
+		return RegisteredKeys().size();
+	}
+
 	// Perform a binary search on a sorted vector. Return the key's location (or
 	// proper insertion spot) in the first element of the pair, and "true" in
 	// the second element if the key is already in the vector.
@@ -52,13 +93,25 @@ namespace {
 
 
 
+Dictionary::Key::Key(const char *name)
+	: name(StringInterner::Intern(name)), index(RegisterKey(this->name))
+{
+}
+
+
+
 double &Dictionary::operator[](const char *key)
 {
 	pair<size_t, bool> pos = Search(key, *this);
 	if(pos.second)
 		return data()[pos.first].second;
 
-	return insert(begin() + pos.first, make_pair(StringInterner::Intern(key), 0.))->second;
+	const char *name = StringInterner::Intern(key);
+	insert(begin() + pos.first, make_pair(name, 0.));
+	keyIndices.insert(keyIndices.begin() + pos.first, FindKey(name));
+	UpdatePositions(pos.first);
+
+	return data()[pos.first].second;
 }
 
 
@@ -88,6 +141,41 @@ double Dictionary::Get(const string &key) const
 void Dictionary::Erase(const char *key)
 {
 	auto [pos, exists] = Search(key, *this);
-	if(exists)
-		erase(next(this->begin(), pos));
+	if(!exists)
+		return;
+
+	if(keyIndices[pos] != NO_KEY)
+		positions[keyIndices[pos]] = 0;
+	erase(next(this->begin(), pos));
+	keyIndices.erase(next(keyIndices.begin(), pos));
+	UpdatePositions(pos);
+}
+
+
+
+void Dictionary::UpdatePositions(size_t first)
+{
+	// If more keys have been registered since this dictionary last checked,
+	// some of its elements may now have registered keys.
+	uint32_t keyCount = RegisteredKeyCount();
+	if(keyCount != registeredKeys)
+	{
+		registeredKeys = keyCount;
+		for(size_t i = 0; i < size(); ++i)
+			keyIndices[i] = FindKey(data()[i].first);
+		positions.clear();
+		first = 0;
+	}
+
+	// Only the elements that were moved by an insertion or erasure need updating,
+	// and the underlying vector already had to move every one of them.
+	for(size_t i = first; i < size(); ++i)
+	{
+		uint32_t index = keyIndices[i];
+		if(index == NO_KEY)
+			continue;
+		if(index >= positions.size())
+			positions.resize(index + 1);
+		positions[index] = i + 1;
+	}
 }
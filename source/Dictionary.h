@@ -15,6 +15,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,6 +28,24 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 // compared to an STL map. That makes it suitable for ship attributes, which are
 // changed much less frequently than they are queried.
 class Dictionary : private std::vector<std::pair<const char *, double>> {
+public:
+	// A key that is registered ahead of time. Every registered key is given a
+	// small dense index, and each dictionary keeps the position of the registered
+	// keys it holds by that index, so looking up a Key is a single array access.
+	// The keys that are looked up every step are all registered in Attribute.h.
+	class Key {
+	public:
+		explicit Key(const char *name);
+
+		const char *Name() const;
+		size_t Index() const;
+
+	private:
+		const char *name;
+		uint32_t index;
+	};
+
+
 public:
 	// Access a key for modifying it:
 	double &operator[](const char *key);
@@ -33,6 +53,7 @@ public:
 	// Get the value of a key, or 0 if it does not exist:
 	double Get(const char *key) const;
 	double Get(const std::string &key) const;
+	double Get(const Key &key) const;
 	// Erase the given element.
 	void Erase(const char *key);
 
@@ -40,4 +61,39 @@ public:
 	using std::vector<std::pair<const char *, double>>::empty;
 	using std::vector<std::pair<const char *, double>>::begin;
 	using std::vector<std::pair<const char *, double>>::end;
+
+
+private:
+	// Update the positions of the registered keys at or after the given position.
+	void UpdatePositions(size_t first);
+
+
+private:
+	// The index of the registered key of each element, if it has one.
+	std::vector<uint32_t> keyIndices;
+	// The position of each registered key plus one, indexed by the key's index.
+	// Zero means the key is not present. It only extends as far as the highest
+	// registered key that this dictionary holds.
+	std::vector<uint32_t> positions;
+	// How many keys were registered when the key indices were last looked up.
+	// Keys registered later than that are looked up by name instead.
+	uint32_t registeredKeys = 0;
 };
+
+
+
+inline const char *Dictionary::Key::Name() const { return name; }
+inline size_t Dictionary::Key::Index() const { return index; }
+
+
+
+// Inline the lookup by key because it gets called so frequently.
+inline double Dictionary::Get(const Key &key) const
+{
+	if(key.Index() >= registeredKeys)
+		return Get(key.Name());
+	if(key.Index() >= positions.size())
+		return 0.;
+	uint32_t position = positions[key.Index()];
+	return position ? data()[position - 1].second : 0.;
+}
@@ -99,10 +99,19 @@ DistanceMap::DistanceMap(const Ship &ship, const System &destination, const Play
 
 
 
+// Start a search that RoutePlan will continue for each destination in turn.
+DistanceMap::DistanceMap(const System &center, const Ship *ship, const PlayerInfo *player)
+	: player(player), center(&center), isResumable(true)
+{
+	Start(ship);
+}
+
+
+
 // Find out if the given system is reachable
 bool DistanceMap::HasRoute(const System &target) const
 {
-	return route.contains(&target);
+	return indices.contains(&target);
 }
 
 
@@ -110,8 +119,8 @@ bool DistanceMap::HasRoute(const System &target) const
 // Find out how many days away the given system is.
 int DistanceMap::Days(const System &target) const
 {
-	auto it = route.find(&target);
-	return (it == route.end() ? -1 : it->second.days);
+	const int index = IndexOf(target);
+	return (index < 0 ? -1 : route[index].days);
 }
 
 
@@ -119,10 +128,7 @@ int DistanceMap::Days(const System &target) const
 // Get a set containing all the systems.
 set<const System *> DistanceMap::Systems() const
 {
-	set<const System *> systems;
-	for(const auto &it : route)
-		systems.insert(it.first);
-	return systems;
+	return set<const System *>(systems.begin(), systems.end());
 }
 
 
@@ -138,7 +144,7 @@ vector<const System *> DistanceMap::Plan(const System &target) const
 	while(nextStep != center)
 	{
 		plan.push_back(nextStep);
-		nextStep = route.at(nextStep).prev;
+		nextStep = route[indices.at(nextStep)].prev;
 	}
 	return plan;
 }
@@ -149,15 +155,27 @@ vector<const System *> DistanceMap::Plan(const System &target) const
 // jump drive paths, or both to find the shortest route. Bail out if the
 // source system or the maximum count is reached.
 void DistanceMap::Init(const Ship *ship)
+{
+	if(Start(ship))
+		Search();
+}
+
+
+
+// Set up the search, returning false if there is nothing to search.
+bool DistanceMap::Start(const Ship *ship)
 {
 	if(!center || (ship && ship->IsRestrictedFrom(*center)) || center == destination)
-		return;
+		return false;
 
 	// To get to the starting point, there is no previous system,
 	// and it takes no fuel or days.
-	route[center] = RouteEdge();
+	indices.emplace(center, systems.size());
+	systems.push_back(center);
+	route.emplace_back();
+	settled.push_back(false);
 	if(!maxDays)
-		return;
+		return false;
 
 	// Check what travel capabilities this ship has. If no ship is given, the
 	// DistanceMap class defaults assume hyperdrive capability only.
@@ -178,7 +196,7 @@ void DistanceMap::Init(const Ship *ship)
 				}
 
 			if(!hasWormhole)
-				return;
+				return false;
 		}
 
 		jumpRangeMax = ship->JumpNavigation().JumpRange();
@@ -191,6 +209,14 @@ void DistanceMap::Init(const Ship *ship)
 
 	// Add this fake edge "from center" so it's the first popped value.
 	edgesTodo.emplace(center);
+	return true;
+}
+
+
+
+// Continue the search until the destination is reached or an end condition is hit.
+void DistanceMap::Search()
+{
 	// Find all edges from that route, add better routes to the map, and continue.
 	while(maxSystems && !edgesTodo.empty())
 	{
@@ -207,9 +233,16 @@ void DistanceMap::Init(const Ship *ship)
 		const System *currentSystem = nextEdge.prev;
 
 		// If a destination is given, stop searching once we have the best route.
-		if(currentSystem == destination)
+		if(currentSystem == destination && !isResumable)
 			break;
 
+		// Skip edges to systems that a better route was found for after they
+		// were added, since the systems they lead to have already been handled.
+		const size_t index = indices.at(currentSystem);
+		if(settled[index])
+			continue;
+		settled[index] = true;
+
 		// Increment the danger to include this system.
 		// Don't need to worry about the danger for the next system because
 		// if you're going there, all routes would include that same danger.
@@ -257,11 +290,37 @@ void DistanceMap::Init(const Ship *ship)
 		// Bail out if the maximum number of systems is reached.
 		if(!Propagate(nextEdge))
 			break;
+
+		// A resumable search stops only once the destination's links have been
+		// added, so that continuing it later is no different from never stopping.
+		if(currentSystem == destination)
+			break;
 	}
 }
 
 
 
+// Continue a resumable search until the route to the given destination is
+// known, returning false if it can not be reached.
+bool DistanceMap::Continue(const System &destination, const Ship *ship)
+{
+	if(&destination == center)
+		return false;
+
+	// The ship the search was started for may no longer exist, but any ship
+	// it is continued for has the same capabilities.
+	if(this->ship && ship)
+		this->ship = ship;
+	this->destination = &destination;
+
+	const int index = IndexOf(destination);
+	if(index < 0 || !settled[index])
+		Search();
+	return HasRoute(destination);
+}
+
+
+
 // Add the given links to the map, if better. Return false if max systems has been reached.
 bool DistanceMap::Propagate(const RouteEdge &curEdge)
 {
@@ -312,8 +371,8 @@ bool DistanceMap::Propagate(const RouteEdge &curEdge)
 // Check if we already have a better path to the given system.
 bool DistanceMap::HasBetter(const System &to, const RouteEdge &edge)
 {
-	auto it = route.find(&to);
-	return (it != route.end() && !(it->second < edge));
+	const int index = IndexOf(to);
+	return (index >= 0 && !(route[index] < edge));
 }
 
 
@@ -323,7 +382,15 @@ void DistanceMap::Add(const System &to, RouteEdge edge)
 {
 	// This is the best path we have found so far to this system, but it is
 	// conceivable that a better one will be found.
-	route[&to] = edge;
+	const auto it = indices.emplace(&to, systems.size()).first;
+	if(it->second == systems.size())
+	{
+		systems.push_back(&to);
+		route.push_back(edge);
+		settled.push_back(false);
+	}
+	else
+		route[it->second] = edge;
 
 	// Start building upon this edge and enqueue - this copy of edge
 	// is in an incomplete state and needs to be dequeued and worked on.
@@ -382,3 +449,13 @@ bool DistanceMap::CheckLink(const System &from, const System &to, bool linked, b
 	fuelCost = ship->JumpNavigation().JumpDriveFuel(distance);
 	return fuelCost > 0;
 }
+
+
+
+// Get the index of the given system in the lists of reached systems, or -1 if
+// it has not been reached.
+int DistanceMap::IndexOf(const System &system) const
+{
+	const auto it = indices.find(&system);
+	return (it == indices.end() ? -1 : static_cast<int>(it->second));
+}
@@ -18,10 +18,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "RouteEdge.h"
 #include "WormholeStrategy.h"
 
-#include <map>
+#include <cstddef>
 #include <queue>
 #include <set>
-#include <utility>
+#include <unordered_map>
 #include <vector>
 
 class PlayerInfo;
@@ -50,6 +50,14 @@ public:
 	// Optional arguments are as above.
 	explicit DistanceMap(const System *center, WormholeStrategy wormholeStrategy,
 			bool useJumpDrive, int maxSystems = -1, int maxDays = -1);
+	// Start a search for routes from the given system that is not carried out
+	// right away. Instead, RoutePlan continues it only as far as is needed to
+	// find the route to each destination it is given, so finding the routes to
+	// many destinations from the same system does not start over each time. If
+	// a ship is given, the routes depend on its capabilities as they would for
+	// a RoutePlan for that ship, and the search may only be continued for ships
+	// with the same capabilities that are in the same system.
+	DistanceMap(const System &center, const Ship *ship, const PlayerInfo *player = nullptr);
 
 	// Find out if the given system is reachable.
 	bool HasRoute(const System &system) const;
@@ -76,6 +84,13 @@ private:
 	// jump drive paths, or both to find the shortest route. Bail out if the
 	// destination system or the maximum count is reached.
 	void Init(const Ship *ship = nullptr);
+	// Set up the search, returning false if there is nothing to search.
+	bool Start(const Ship *ship);
+	// Continue the search until the destination is reached or an end condition is hit.
+	void Search();
+	// Continue a resumable search until the route to the given destination is
+	// known, returning false if it can not be reached.
+	bool Continue(const System &destination, const Ship *ship);
 	// Add the given links to the map. Return false if an end condition is hit.
 	bool Propagate(const RouteEdge &curEdge);
 	// Check if we already have a better path to the given system.
@@ -89,10 +104,22 @@ private:
 
 
 private:
+	// Get the index of the given system in the lists below, or -1 if it has not been reached.
+	int IndexOf(const System &system) const;
+
+
+private:
+	// The systems that have been reached, in the order they were first reached,
+	// and the index of each one in that list.
+	std::vector<const System *> systems;
+	std::unordered_map<const System *, size_t> indices;
 	// Final route, each Edge pointing to the previous step along the route.
-	std::map<const System *, RouteEdge> route;
+	std::vector<RouteEdge> route;
+	// Whether the best route to each system is known. Until the map is done,
+	// the routes to some systems may still be replaced by better ones.
+	std::vector<bool> settled;
 
-	// Variables only used during construction:
+	// Variables only used during construction, or while continuing a resumable search:
 	// 'edgesTodo' holds unfinished candidate Edges - Only the 'prev' value
 	// is up-to-date. Other values are one step behind, awaiting an update.
 	// The top() value is the best route among uncertain systems. Once
@@ -104,6 +131,8 @@ private:
 	int maxSystems = -1;
 	int maxDays = -1;
 	const System *destination = nullptr;
+	// Whether the search stops after each destination so that it can be continued later.
+	bool isResumable = false;
 	WormholeStrategy wormholeStrategy = WormholeStrategy::ALL;
 
 	double jumpRangeMax = 0.;
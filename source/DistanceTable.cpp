@@ -0,0 +1,125 @@
+/* DistanceTable.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DistanceTable.h"
+
+#include "DistanceCalculationSettings.h"
+#include "DistanceMap.h"
+#include "System.h"
+
+#include <limits>
+
+using namespace std;
+
+namespace {
+	// The value stored for systems that can not be reached.
+	constexpr uint16_t UNREACHABLE = numeric_limits<uint16_t>::max();
+
+	// Get which table holds the distances for the given settings.
+	size_t TableIndex(WormholeStrategy wormholeStrategy, bool useJumpDrive)
+	{
+		return 2 * static_cast<size_t>(wormholeStrategy) + useJumpDrive;
+	}
+}
+
+
+
+void DistanceTable::Update(const Set<System> &systems)
+{
+	lock_guard<std::mutex> lock(mutex);
+	if(indexedSize == systems.size())
+		return;
+
+	for(auto &table : tables)
+		table.clear();
+	indices.clear();
+	indexedSize = systems.size();
+	for(const auto &it : systems)
+		indices.emplace(&it.second, indices.size());
+}
+
+
+
+void DistanceTable::Clear()
+{
+	lock_guard<std::mutex> lock(mutex);
+	for(auto &table : tables)
+		for(vector<uint16_t> &row : table)
+			row = vector<uint16_t>();
+}
+
+
+
+int DistanceTable::Days(const System &from, const System &to, WormholeStrategy wormholeStrategy, bool useJumpDrive)
+{
+	lock_guard<std::mutex> lock(mutex);
+	const auto fromIt = indices.find(&from);
+	const auto toIt = indices.find(&to);
+	// Systems that were not indexed have to be looked up the slow way.
+	if(fromIt == indices.end() || toIt == indices.end())
+		return DistanceMap(&from, wormholeStrategy, useJumpDrive).Days(to);
+
+	auto &table = tables[TableIndex(wormholeStrategy, useJumpDrive)];
+	if(table.empty())
+		table.resize(indices.size());
+	vector<uint16_t> &row = table[fromIt->second];
+	if(row.empty())
+		FillRow(row, from, wormholeStrategy, useJumpDrive);
+
+	const uint16_t days = row[toIt->second];
+	return days == UNREACHABLE ? -1 : days;
+}
+
+
+
+int DistanceTable::Days(const System &from, const System &to, const DistanceCalculationSettings &settings)
+{
+	return Days(from, to, settings.WormholeStrat(), settings.AssumesJumpDrive());
+}
+
+
+
+size_t DistanceTable::MemoryUse() const
+{
+	lock_guard<std::mutex> lock(mutex);
+	size_t bytes = 0;
+	for(const auto &table : tables)
+	{
+		bytes += table.capacity() * sizeof(vector<uint16_t>);
+		for(const vector<uint16_t> &row : table)
+			bytes += row.capacity() * sizeof(uint16_t);
+	}
+	return bytes;
+}
+
+
+
+void DistanceTable::FillRow(vector<uint16_t> &row, const System &from, WormholeStrategy wormholeStrategy,
+	bool useJumpDrive) const
+{
+	row.assign(indices.size(), UNREACHABLE);
+	const DistanceMap distance(&from, wormholeStrategy, useJumpDrive);
+	for(const System *system : distance.Systems())
+	{
+		auto it = indices.find(system);
+		if(it == indices.end())
+			continue;
+		// A route that is too long to store is treated as unreachable, but that
+		// can only happen in a map with tens of thousands of systems.
+		const int days = distance.Days(*system);
+		if(days >= 0 && days < UNREACHABLE)
+			row[it->second] = days;
+	}
+}
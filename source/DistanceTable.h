@@ -0,0 +1,74 @@
+/* DistanceTable.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Set.h"
+#include "WormholeStrategy.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class DistanceCalculationSettings;
+class System;
+
+
+
+// A table of the number of jumps between every pair of systems, as found by a
+// DistanceMap that starts from the first system and does not depend on any
+// particular ship or player. There is a separate table for each combination of
+// wormhole strategy and jump drive use. Each row of a table holds the distances
+// from one system to all others, and is filled in the first time it is needed,
+// so that looking up distances from several different systems in turn does not
+// require the routes to be calculated again each time.
+class DistanceTable {
+public:
+	// Index the given systems, unless they are already indexed. This also
+	// forgets all distances if the number of systems has changed.
+	void Update(const Set<System> &systems);
+	// Forget all distances, because the systems, the links between them, or
+	// the wormholes in them may have changed.
+	void Clear();
+
+	// Get the number of days it takes to travel from one system to the other,
+	// i.e. the value that DistanceMap::Days() would return. Returns -1 if the
+	// destination can not be reached.
+	int Days(const System &from, const System &to, WormholeStrategy wormholeStrategy, bool useJumpDrive);
+	int Days(const System &from, const System &to, const DistanceCalculationSettings &settings);
+
+	// Get the number of bytes used by the distances that have been calculated.
+	size_t MemoryUse() const;
+
+
+private:
+	// Calculate the distances from the given system to all others.
+	void FillRow(std::vector<uint16_t> &row, const System &from, WormholeStrategy wormholeStrategy,
+		bool useJumpDrive) const;
+
+
+private:
+	// The column of each system in the tables.
+	std::unordered_map<const System *, size_t> indices;
+	// Each table has one row for each system, which is empty until its
+	// distances have been calculated.
+	std::array<std::vector<std::vector<uint16_t>>, 6> tables;
+	int indexedSize = -1;
+
+	mutable std::mutex mutex;
+};
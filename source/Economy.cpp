@@ -0,0 +1,124 @@
+/* Economy.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Economy.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+
+
+
+void Economy::Update(Set<System> &systems, const vector<Trade::Commodity> &commodities)
+{
+	if(indexedSize == systems.size())
+		return;
+
+	Clear();
+	indexedSize = systems.size();
+	columns = commodities.size();
+
+	// Only systems that trade something need a row. The systems are kept in
+	// the same order as before, so they produce goods in the same order.
+	unordered_map<const System *, size_t> rows;
+	for(auto &it : systems)
+		if(it.second.HasTrade())
+		{
+			rows.emplace(&it.second, this->systems.size());
+			this->systems.push_back(&it.second);
+		}
+
+	prices.reserve(this->systems.size() * columns);
+	for(System *system : this->systems)
+		for(const Trade::Commodity &commodity : commodities)
+			prices.push_back(system->GetPrice(commodity.name));
+
+	supply.resize(prices.size());
+	exports.resize(supply.size());
+	traded.resize(supply.size());
+	neighborStart.reserve(this->systems.size() + 1);
+	for(const System *system : this->systems)
+	{
+		// Neighbors that do not trade anything have no exports to share.
+		neighborStart.push_back(neighborRows.size());
+		for(const System *neighbor : system->Links())
+		{
+			auto it = rows.find(neighbor);
+			if(it != rows.end() && !neighbor->Links().empty())
+			{
+				neighborRows.push_back(it->second);
+				neighborLinks.push_back(neighbor->Links().size());
+			}
+		}
+	}
+	neighborStart.push_back(neighborRows.size());
+}
+
+
+
+void Economy::Clear()
+{
+	systems.clear();
+	columns = 0;
+	prices.clear();
+	supply.clear();
+	exports.clear();
+	traded.clear();
+	neighborStart.clear();
+	neighborRows.clear();
+	neighborLinks.clear();
+	indexedSize = -1;
+}
+
+
+
+void Economy::Step()
+{
+	// First, have each system generate new goods for local use and trade.
+	for(System *system : systems)
+		system->StepEconomy();
+
+	// Systems have no supply or exports of goods they do not trade.
+	for(size_t i = 0; i < prices.size(); ++i)
+	{
+		supply[i] = prices[i] ? prices[i]->supply : 0.;
+		exports[i] = prices[i] ? prices[i]->exports : 0.;
+	}
+
+	// Then, send out the trade goods. Each system's new supply is based on
+	// what all the others had before trading, so they can be done in any order.
+	for(size_t row = 0; row < systems.size(); ++row)
+	{
+		double *out = traded.data() + row * columns;
+		const double *in = supply.data() + row * columns;
+		copy(in, in + columns, out);
+		for(size_t link = neighborStart[row]; link < neighborStart[row + 1]; ++link)
+		{
+			const double *neighborExports = exports.data() + neighborRows[link] * columns;
+			const double scale = neighborLinks[link];
+			for(size_t column = 0; column < columns; ++column)
+				out[column] += neighborExports[column] / scale;
+		}
+	}
+
+	// Finally, store the new supplies, which also updates the prices.
+	for(size_t i = 0; i < prices.size(); ++i)
+		if(prices[i])
+		{
+			prices[i]->supply = traded[i];
+			prices[i]->Update();
+		}
+}
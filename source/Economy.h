@@ -0,0 +1,67 @@
+/* Economy.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Set.h"
+#include "System.h"
+#include "Trade.h"
+
+#include <cstddef>
+#include <vector>
+
+
+
+// The daily simulation of the supply of each commodity in every system. Each
+// system produces goods and then trades some of them with its neighbors. The
+// supplies are stored in dense arrays, with a row for each system that has any
+// trade and a column for each commodity, and the hyperspace links between those
+// systems are stored as a list of neighbor rows for each row. The systems still
+// hold the prices that everything else reads, so the economy also keeps a
+// pointer to each system's price entry for each commodity. That way, neither
+// the trading nor copying the supplies in and out looks up anything by name.
+class Economy {
+public:
+	// Index the given systems and commodities, unless they are already indexed.
+	// Call Clear() if the trade or links of any system may have changed.
+	void Update(Set<System> &systems, const std::vector<Trade::Commodity> &commodities);
+	void Clear();
+
+	// Advance the economy of the indexed systems by one day.
+	void Step();
+
+
+private:
+	// The systems that have any trade, one for each row.
+	std::vector<System *> systems;
+	// The number of commodities, one for each column.
+	size_t columns = 0;
+	// The price entry of each commodity in each system, or null if that system
+	// does not trade it. These stay valid until the system's trade is changed.
+	std::vector<System::Price *> prices;
+	// The supply and exports of each commodity in each system, and the supply
+	// after trading with the neighboring systems.
+	std::vector<double> supply;
+	std::vector<double> exports;
+	std::vector<double> traded;
+
+	// The neighbors of the system in row i are neighborRows[neighborStart[i]]
+	// up to neighborRows[neighborStart[i + 1]]. Each neighbor's exports are
+	// split evenly between all the systems it links to.
+	std::vector<size_t> neighborStart;
+	std::vector<size_t> neighborRows;
+	std::vector<double> neighborLinks;
+	int indexedSize = -1;
+};
@@ -16,6 +16,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Engine.h"
 
 #include "AlertLabel.h"
+#include "Attribute.h"
 #include "audio/Audio.h"
 #include "CategoryList.h"
 #include "CategoryType.h"
@@ -52,6 +53,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "PlayerInfo.h"
 #include "shader/PointerShader.h"
 #include "Preferences.h"
+#include "Profiler.h"
 #include "Projectile.h"
 #include "Random.h"
 #include "shader/RingShader.h"
@@ -500,6 +502,7 @@ void Engine::Step(bool isActive)
 	queue.ProcessSyncTasks();
 
 	// The calculation thread was paused by MainPanel before calling this function, so it is safe to access things.
+	routeCacheCounters = ai.GetRouteCacheCounters();
 	const shared_ptr<Ship> flagship = player.FlagshipPtr();
 	const StellarObject *object = player.GetStellarObject();
 	if(object)
@@ -750,7 +753,7 @@ void Engine::Step(bool isActive)
 		// Have an alarm label flash up when enemy ships are in the system
 		if(alarmTime && uiStep / 20 % 2 && Preferences::DisplayVisualAlert())
 			info.SetCondition("red alert");
-		double fuelCap = flagship->Attributes().Get("fuel capacity");
+		double fuelCap = flagship->Attributes().Get(Attribute::FUEL_CAPACITY);
 		// If the flagship has a large amount of fuel, display a solid bar.
 		// Otherwise, display a segment for every 100 units of fuel.
 		if(fuelCap <= MAX_FUEL_DISPLAY)
@@ -837,7 +840,8 @@ void Engine::Step(bool isActive)
 
 		targetVector = targetAsteroid->Position() - camera.Center();
 
-		if(flagship->Attributes().Get("tactical scan power") || flagship->Attributes().Get("strategic scan power"))
+		if(flagship->Attributes().Get(Attribute::TACTICAL_SCAN_POWER)
+				|| flagship->Attributes().Get(Attribute::STRATEGIC_SCAN_POWER))
 		{
 			info.SetCondition("range display");
 			info.SetBar("target hull", targetAsteroid->Hull(), 20.);
@@ -890,18 +894,19 @@ void Engine::Step(bool isActive)
 
 			double targetRange = target->Position().Distance(flagship->Position());
 			// Finds the range of the scan collections.
-			double tacticalRange = 100. * sqrt(flagship->Attributes().Get("tactical scan power"));
-			double strategicRange = 100. * sqrt(flagship->Attributes().Get("strategic scan power"));
+			double tacticalRange = 100. * sqrt(flagship->Attributes().Get(Attribute::TACTICAL_SCAN_POWER));
+			double strategicRange = 100. * sqrt(flagship->Attributes().Get(Attribute::STRATEGIC_SCAN_POWER));
 			// Finds the range of the individual information types.
-			double crewScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get("crew scan power"));
-			double fuelScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get("fuel scan power"));
-			double energyScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get("energy scan power"));
-			double thermalScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get("thermal scan power"));
-			double maneuverScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get("maneuver scan power"));
-			double accelerationScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get("acceleration scan power"));
-			double velocityScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get("velocity scan power"));
-			double weaponScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get("weapon scan power"));
-			bool rangeFinder = flagship->Attributes().Get("range finder power") > 0.;
+			double crewScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get(Attribute::CREW_SCAN_POWER));
+			double fuelScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get(Attribute::FUEL_SCAN_POWER));
+			double energyScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get(Attribute::ENERGY_SCAN_POWER));
+			double thermalScanRange = tacticalRange + 100. * sqrt(flagship->Attributes().Get(Attribute::THERMAL_SCAN_POWER));
+			double maneuverScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get(Attribute::MANEUVER_SCAN_POWER));
+			double accelerationScanRange = strategicRange
+				+ 100. * sqrt(flagship->Attributes().Get(Attribute::ACCELERATION_SCAN_POWER));
+			double velocityScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get(Attribute::VELOCITY_SCAN_POWER));
+			double weaponScanRange = strategicRange + 100. * sqrt(flagship->Attributes().Get(Attribute::WEAPON_SCAN_POWER));
+			bool rangeFinder = flagship->Attributes().Get(Attribute::RANGE_FINDER_POWER) > 0.;
 
 			// Range information. If the player has any range finding,
 			// then calculate the range and store it. If they do not
@@ -919,7 +924,7 @@ void Engine::Step(bool isActive)
 			// that is within the relevant scanner range, unless the target
 			// is player owned, in which case information is available regardless
 			// of range and scrutability.
-			bool scrutable = !target->Attributes().Get("inscrutable");
+			bool scrutable = !target->Attributes().Get(Attribute::INSCRUTABLE);
 			if((targetRange <= crewScanRange && scrutable) || (crewScanRange && target->IsYours()))
 			{
 				info.SetString("target crew", to_string(target->Crew()));
@@ -931,13 +936,13 @@ void Engine::Step(bool isActive)
 			if((targetRange <= energyScanRange && scrutable) || (energyScanRange && target->IsYours()))
 			{
 				info.SetCondition("target energy display");
-				int energy = round(target->Energy() * target->Attributes().Get("energy capacity"));
+				int energy = round(target->Energy() * target->Attributes().Get(Attribute::ENERGY_CAPACITY));
 				info.SetString("target energy", to_string(energy));
 			}
 			if((targetRange <= fuelScanRange && scrutable) || (fuelScanRange && target->IsYours()))
 			{
 				info.SetCondition("target fuel display");
-				int fuel = round(target->Fuel() * target->Attributes().Get("fuel capacity"));
+				int fuel = round(target->Fuel() * target->Attributes().Get(Attribute::FUEL_CAPACITY));
 				info.SetString("target fuel", to_string(fuel));
 			}
 			if((targetRange <= thermalScanRange && scrutable) || (thermalScanRange && target->IsYours()))
@@ -990,11 +995,11 @@ void Engine::Step(bool isActive)
 	{
 		double width = max(target->Width(), target->Height());
 		Point pos = target->Position() - camera.Center();
-		const bool outfitInRange = pos.LengthSquared() <= (flagship->Attributes().Get("outfit scan power") * 10000);
+		const bool outfitInRange = pos.LengthSquared() <= (flagship->Attributes().Get(Attribute::OUTFIT_SCAN_POWER) * 10000);
 		const Status::Type outfitOverlayType = outfitInRange ? Status::Type::SCAN : Status::Type::SCAN_OUT_OF_RANGE;
 		statuses.emplace_back(pos, flagship->OutfitScanFraction(), 0.,
 			0., 10. + max(20., width * .5), outfitOverlayType, 1.f, Angle(pos).Degrees() + 180.);
-		const bool cargoInRange = pos.LengthSquared() <= (flagship->Attributes().Get("cargo scan power") * 10000);
+		const bool cargoInRange = pos.LengthSquared() <= (flagship->Attributes().Get(Attribute::CARGO_SCAN_POWER) * 10000);
 		const Status::Type cargoOverlayType = cargoInRange ? Status::Type::SCAN : Status::Type::SCAN_OUT_OF_RANGE;
 		statuses.emplace_back(pos, 0., flagship->CargoScanFraction(),
 			0., 10. + max(20., width * .5), cargoOverlayType, 1.f, Angle(pos).Degrees() + 180.);
@@ -1063,7 +1068,7 @@ void Engine::Step(bool isActive)
 	bool shouldCatalogAsteroids = (!isAsteroidCatalogComplete && !Random::Int(20));
 	if(shouldShowAsteroidOverlay || shouldCatalogAsteroids)
 	{
-		double scanRangeMetric = flagship ? 10000. * flagship->Attributes().Get("asteroid scan power") : 0.;
+		double scanRangeMetric = flagship ? 10000. * flagship->Attributes().Get(Attribute::ASTEROID_SCAN_POWER) : 0.;
 		if(flagship && scanRangeMetric && !flagship->IsHyperspacing())
 		{
 			bool scanComplete = true;
@@ -1114,12 +1119,15 @@ void Engine::Step(bool isActive)
 
 
 // Begin the next step of calculations.
-void Engine::Go()
+void Engine::Go(bool inBackground)
 {
 	if(!timePaused)
 		++step;
 	currentCalcBuffer = currentCalcBuffer ? 0 : 1;
-	queue.Run([this] { CalculateStep(); });
+	if(inBackground)
+		queue.Run([this] { CalculateStep(); });
+	else
+		CalculateStep();
 }
 
 
@@ -1132,6 +1140,20 @@ bool Engine::IsPaused() const
 
 
 
+const AI::RouteCacheCounters &Engine::GetRouteCacheCounters() const
+{
+	return routeCacheCounters;
+}
+
+
+
+const Engine::StepTimes &Engine::GetStepTimes() const
+{
+	return stepTimes;
+}
+
+
+
 // Give a command on behalf of the player, used for integration tests.
 void Engine::GiveCommand(const Command &command)
 {
@@ -1584,10 +1606,14 @@ void Engine::EnterSystem()
 
 void Engine::CalculateStep()
 {
+	Profiler::Scope profile("Engine::CalculateStep");
+
 	// If there is a pending zoom update then use it
 	// because the zoom will get updated in the main thread
 	// as soon as the calculation thread is finished.
 	const double zoom = nextZoom ? nextZoom : this->zoom;
+	const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	stepTimes = {};
 
 	// Clear the list of objects to draw.
 	draw[currentCalcBuffer].Clear(step, zoom);
@@ -1614,6 +1640,8 @@ void Engine::CalculateStep()
 		CalculateUnpaused(flagship, playerSystem);
 
 	// Draw the objects. Start by figuring out where the view should be centered:
+	Profiler::Scope profileDraw("Engine::DrawLists");
+	const chrono::steady_clock::time_point drawStart = chrono::steady_clock::now();
 	Camera newCamera = camera;
 	if(flagship && !timePaused)
 	{
@@ -1701,6 +1729,10 @@ void Engine::CalculateStep()
 	// Draw the visuals.
 	for(const Visual &visual : visuals)
 		batchDraw[currentCalcBuffer].AddVisual(visual);
+
+	const chrono::steady_clock::time_point end = chrono::steady_clock::now();
+	stepTimes.drawLists = end - drawStart;
+	stepTimes.total = end - start;
 }
 
 
@@ -1708,8 +1740,12 @@ void Engine::CalculateStep()
 // Calculate things that require the engine not to be paused.
 void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 {
+	Profiler::Scope profile("Engine::CalculateUnpaused");
+
 	// Now, all the ships must decide what they are doing next.
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
 	ai.Step(activeCommands);
+	stepTimes.ai = chrono::steady_clock::now() - start;
 
 	// Clear the active player's commands, because they are all processed at this point.
 	activeCommands.Clear();
@@ -1727,6 +1763,7 @@ void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 	bool flagshipWasUntargetable = (flagship && !flagship->IsTargetable());
 	bool wasHyperspacing = (flagship && flagship->IsEnteringHyperspace());
 	// First, move the player's flagship.
+	start = chrono::steady_clock::now();
 	if(flagship)
 	{
 		emptySoundsTimer.resize(flagship->Weapons().size());
@@ -1751,13 +1788,14 @@ void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 			&& isTargetable && flagshipIsTargetable)
 				eventQueue.emplace_back(player.FlagshipPtr(), it, ShipEvent::ENCOUNTER);
 	}
+	stepTimes.ships = chrono::steady_clock::now() - start;
 	// If the flagship just began jumping, play the appropriate sound.
 	if(!wasHyperspacing && flagship && flagship->IsEnteringHyperspace())
 	{
 		bool isJumping = flagship->IsUsingJumpDrive();
 		const map<const Sound *, int> &jumpSounds = isJumping
 			? flagship->Attributes().JumpSounds() : flagship->Attributes().HyperSounds();
-		if(flagship->Attributes().Get("silent jumps"))
+		if(flagship->Attributes().Get(Attribute::SILENT_JUMPS))
 		{
 			// No sounds.
 		}
@@ -1802,9 +1840,10 @@ void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 	PrunePointers(flotsam);
 
 	// Move the projectiles.
-	for(Projectile &projectile : projectiles)
-		projectile.Move(newVisuals, newProjectiles);
+	start = chrono::steady_clock::now();
+	Projectile::MoveAll(projectiles, newVisuals, newProjectiles);
 	Prune(projectiles);
+	stepTimes.projectiles = chrono::steady_clock::now() - start;
 
 	// Step the weather.
 	for(Weather &weather : activeWeather)
@@ -1838,11 +1877,17 @@ void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 		--grudgeTime;
 
 	// Populate the collision detection lookup sets.
+	start = chrono::steady_clock::now();
 	FillCollisionSets();
 
-	// Perform collision detection.
-	for(Projectile &projectile : projectiles)
-		DoCollisions(projectile);
+	// Perform collision detection. The possible ship collisions of every
+	// projectile are found up front, in a single pass over the grid.
+	{
+		Profiler::Scope profileCollisions("Engine::DoCollisions");
+		shipCollisions.Lines(projectiles, shipLineCollisions, shipLineOffsets);
+		for(size_t i = 0; i < projectiles.size(); ++i)
+			DoCollisions(projectiles[i], i);
+	}
 	// Now that collision detection is done, clear the cache of ships with anti-
 	// missile systems ready to fire.
 	hasAntiMissile.clear();
@@ -1858,6 +1903,7 @@ void Engine::CalculateUnpaused(const Ship *flagship, const System *playerSystem)
 	// Now that flotsam collection is done, clear the cache of ships with
 	// tractor beam systems ready to fire.
 	hasTractorBeam.clear();
+	stepTimes.collisions = chrono::steady_clock::now() - start;
 
 	// Check for ship scanning.
 	for(const shared_ptr<Ship> &it : ships)
@@ -1920,7 +1966,7 @@ void Engine::MoveShip(const shared_ptr<Ship> &ship)
 		{
 			const map<const Sound *, int> &jumpSounds = isJump
 				? ship->Attributes().JumpOutSounds() : ship->Attributes().HyperOutSounds();
-			if(ship->Attributes().Get("silent jumps"))
+			if(ship->Attributes().Get(Attribute::SILENT_JUMPS))
 			{
 				// No sounds.
 			}
@@ -1936,7 +1982,7 @@ void Engine::MoveShip(const shared_ptr<Ship> &ship)
 		{
 			const map<const Sound *, int> &jumpSounds = isJump
 				? ship->Attributes().JumpInSounds() : ship->Attributes().HyperInSounds();
-			if(ship->Attributes().Get("silent jumps"))
+			if(ship->Attributes().Get(Attribute::SILENT_JUMPS))
 			{
 				// No sounds.
 			}
@@ -1980,6 +2026,8 @@ void Engine::MoveShip(const shared_ptr<Ship> &ship)
 // Populate the ship collision detection set for projectile & flotsam computations.
 void Engine::FillCollisionSets()
 {
+	Profiler::Scope profile("Engine::FillCollisionSets");
+
 	shipCollisions.Clear(step);
 	for(const shared_ptr<Ship> &it : ships)
 		if(it->GetSystem() == player.GetSystem() && it->Zoom() == 1.)
@@ -2303,10 +2351,10 @@ void Engine::HandleMouseClicks()
 			}
 		}
 	}
-	else if(flagship->Attributes().Get("asteroid scan power"))
+	else if(flagship->Attributes().Get(Attribute::ASTEROID_SCAN_POWER))
 	{
 		// If the click was not on any ship, check if it was on a minable.
-		double scanRange = 100. * sqrt(flagship->Attributes().Get("asteroid scan power"));
+		double scanRange = 100. * sqrt(flagship->Attributes().Get(Attribute::ASTEROID_SCAN_POWER));
 		for(const shared_ptr<Minable> &minable : asteroids.Minables())
 		{
 			Point position = minable->Position() - flagship->Position();
@@ -2369,8 +2417,10 @@ void Engine::HandleMouseInput(Command &activeCommands)
 
 // Perform collision detection. Note that unlike the preceding functions, this
 // one adds any visuals that are created directly to the main visuals list. If
-// this is multi-threaded in the future, that will need to change.
-void Engine::DoCollisions(Projectile &projectile)
+// this is multi-threaded in the future, that will need to change. The index is
+// the projectile's position in the list of projectiles, which is where its
+// possible ship collisions were stored by CollisionSet::Lines().
+void Engine::DoCollisions(Projectile &projectile, size_t index)
 {
 	// The asteroids can collide with projectiles, the same as any other
 	// object. If the asteroid turns out to be closer than the ship, it
@@ -2420,7 +2470,8 @@ void Engine::DoCollisions(Projectile &projectile)
 		if(collisions.empty())
 		{
 			if(weapon.CanCollideShips())
-				shipCollisions.Line(projectile, collisions);
+				collisions.insert(collisions.end(), shipLineCollisions.begin() + shipLineOffsets[index],
+					shipLineCollisions.begin() + shipLineOffsets[index + 1]);
 			if(weapon.CanCollideAsteroids())
 				asteroids.CollideAsteroids(projectile, collisions);
 			if(weapon.CanCollideMinables())
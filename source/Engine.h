@@ -37,6 +37,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Rectangle.h"
 #include "TaskQueue.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <map>
@@ -79,10 +80,26 @@ public:
 	// Perform all the work that can only be done while the calculation thread
 	// is paused (for thread safety reasons).
 	void Step(bool isActive);
-	// Begin the next step of calculations.
-	void Go();
+	// Begin the next step of calculations. Unless it is done in the background,
+	// it is finished before this returns.
+	void Go(bool inBackground = true);
 	// Whether the player has the game paused.
 	bool IsPaused() const;
+	// Get the AI's route cache statistics, as of the last call to Step().
+	const AI::RouteCacheCounters &GetRouteCacheCounters() const;
+
+	// How long each part of a calculation step took.
+	struct StepTimes {
+		std::chrono::steady_clock::duration ai{};
+		std::chrono::steady_clock::duration ships{};
+		std::chrono::steady_clock::duration projectiles{};
+		std::chrono::steady_clock::duration collisions{};
+		std::chrono::steady_clock::duration drawLists{};
+		std::chrono::steady_clock::duration total{};
+	};
+	// Get the times of the last calculation step. This must only be called
+	// while the calculation thread is paused.
+	const StepTimes &GetStepTimes() const;
 
 	// Give a command on behalf of the player, used for integration tests.
 	void GiveCommand(const Command &command);
@@ -197,7 +214,7 @@ private:
 
 	void FillCollisionSets();
 
-	void DoCollisions(Projectile &projectile);
+	void DoCollisions(Projectile &projectile, size_t index);
 	void DoWeather(Weather &weather);
 	void DoCollection(Flotsam &flotsam);
 	void DoScanning(const std::shared_ptr<Ship> &ship);
@@ -235,6 +252,8 @@ private:
 	std::vector<Ship *> hasTractorBeam;
 
 	AI ai;
+	AI::RouteCacheCounters routeCacheCounters;
+	StepTimes stepTimes;
 
 	TaskQueue queue;
 
@@ -288,6 +307,10 @@ private:
 	int grudgeTime = 0;
 
 	CollisionSet shipCollisions;
+	// The possible ship collisions of each projectile this step, as found by
+	// CollisionSet::Lines().
+	std::vector<Collision> shipLineCollisions;
+	std::vector<unsigned> shipLineOffsets;
 
 	int alarmTime = 0;
 	double flash = 0.;
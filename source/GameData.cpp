@@ -24,6 +24,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Conversation.h"
 #include "DataNode.h"
 #include "DataWriter.h"
+#include "DistanceTable.h"
+#include "Economy.h"
 #include "Effect.h"
 #include "Files.h"
 #include "shader/FillShader.h"
@@ -41,6 +43,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "image/MaskManager.h"
 #include "Minable.h"
 #include "Mission.h"
+#include "MissionIndex.h"
 #include "audio/Music.h"
 #include "News.h"
 #include "Outfit.h"
@@ -89,6 +92,9 @@ namespace {
 	TextReplacements defaultSubstitutions;
 
 	Politics politics;
+	MissionIndex missionIndex;
+	DistanceTable distances;
+	Economy economy;
 
 	StarField background;
 
@@ -104,6 +110,7 @@ namespace {
 	ConditionsStore globalConditions;
 
 	bool preventSpriteUpload = false;
+	bool isDebugMode = false;
 
 	// Tracks the progress of loading the sprites when the game starts.
 	std::atomic<bool> queuedAllImages = false;
@@ -196,6 +203,7 @@ shared_future<void> GameData::BeginLoad(TaskQueue &queue, const PlayerInfo &play
 		bool onlyLoadData, bool debugMode, bool preventUpload)
 {
 	preventSpriteUpload = preventUpload;
+	isDebugMode = debugMode;
 
 	// Initialize the list of "source" folders based on any active plugins.
 	LoadSources(queue);
@@ -263,6 +271,9 @@ void GameData::FinishLoading()
 	playerGovernment = objects.governments.Get("Escort");
 
 	politics.Reset();
+	missionIndex.Clear();
+	distances.Clear();
+	economy.Clear();
 	background.FinishLoading();
 }
 
@@ -359,6 +370,13 @@ bool GameData::IsLoaded()
 
 
 
+bool GameData::IsDebugMode()
+{
+	return isDebugMode;
+}
+
+
+
 // Begin loading a sprite that was previously deferred. Currently this is
 // done with all landscapes to speed up the program's startup.
 void GameData::Preload(TaskQueue &queue, const Sprite *sprite)
@@ -439,6 +457,8 @@ void GameData::Revert()
 		it.second.Restore();
 
 	politics.Reset();
+	distances.Clear();
+	economy.Clear();
 	purchases.clear();
 }
 
@@ -544,29 +564,10 @@ void GameData::StepEconomy()
 	}
 	purchases.clear();
 
-	// Then, have each system generate new goods for local use and trade.
-	for(auto &it : objects.systems)
-		it.second.StepEconomy();
-
-	// Finally, send out the trade goods. This has to be done in a separate step
-	// because otherwise whichever systems trade last would already have gotten
-	// supplied by the other systems.
-	for(auto &it : objects.systems)
-	{
-		System &system = it.second;
-		if(!system.Links().empty())
-			for(const Trade::Commodity &commodity : Commodities())
-			{
-				double supply = system.Supply(commodity.name);
-				for(const System *neighbor : system.Links())
-				{
-					double scale = neighbor->Links().size();
-					if(scale)
-						supply += neighbor->Exports(commodity.name) / scale;
-				}
-				system.SetSupply(commodity.name, supply);
-			}
-	}
+	// Then, have each system generate new goods for local use and trade, and
+	// send out the trade goods to its neighbors.
+	economy.Update(objects.systems, Commodities());
+	economy.Step();
 }
 
 
@@ -583,6 +584,18 @@ void GameData::AddPurchase(const System &system, const string &commodity, int to
 void GameData::Change(const DataNode &node, PlayerInfo &player)
 {
 	objects.Change(node, player);
+
+	// Changing a government may change which governments are hostile.
+	const string &key = node.Token(0);
+	if(key == "government" || key == "event")
+		politics.UpdateHostility(objects.governments);
+	// Changing the map or its wormholes may change the distances between systems.
+	if(key == "system" || key == "link" || key == "unlink" || key == "planet" || key == "wormhole"
+			|| key == "event")
+		distances.Clear();
+	// Changing a system may change what it trades or which systems it trades with.
+	if(key == "system" || key == "link" || key == "unlink" || key == "event")
+		economy.Clear();
 }
 
 
@@ -592,6 +605,8 @@ void GameData::Change(const DataNode &node, PlayerInfo &player)
 void GameData::UpdateSystems()
 {
 	objects.UpdateSystems();
+	distances.Clear();
+	economy.Clear();
 }
 
 
@@ -599,6 +614,7 @@ void GameData::UpdateSystems()
 void GameData::RecomputeWormholeRequirements()
 {
 	objects.RecomputeWormholeRequirements();
+	distances.Clear();
 }
 
 
@@ -853,6 +869,22 @@ Politics &GameData::GetPolitics()
 
 
 
+MissionIndex &GameData::GetMissionIndex()
+{
+	missionIndex.Update(objects.missions);
+	return missionIndex;
+}
+
+
+
+DistanceTable &GameData::Distances()
+{
+	distances.Update(objects.systems);
+	return distances;
+}
+
+
+
 const vector<StartConditions> &GameData::StartOptions()
 {
 	return objects.startConditions;
@@ -36,6 +36,7 @@ class Conversation;
 class DataNode;
 class DataWriter;
 class Date;
+class DistanceTable;
 class Effect;
 class Fleet;
 class FormationPattern;
@@ -49,6 +50,7 @@ class Interface;
 class MaskManager;
 class Minable;
 class Mission;
+class MissionIndex;
 class News;
 class Outfit;
 class Panel;
@@ -91,6 +93,8 @@ public:
 	static double GetProgress();
 	// Whether initial game loading is complete (data, sprites and audio are loaded).
 	static bool IsLoaded();
+	// Check if the game was started with debugging features turned on.
+	static bool IsDebugMode();
 	// Begin loading a sprite that was previously deferred. Currently this is
 	// done with all landscapes to speed up the program's startup.
 	static void Preload(TaskQueue &queue, const Sprite *sprite);
@@ -158,6 +162,10 @@ public:
 
 	static const Government *PlayerGovernment();
 	static Politics &GetPolitics();
+	// Get the table of jump distances between all systems.
+	static DistanceTable &Distances();
+	// Get the index of the missions that can be offered when landing.
+	static MissionIndex &GetMissionIndex();
 	static const std::vector<StartConditions> &StartOptions();
 
 	static const std::vector<Trade::Commodity> &Commodities();
@@ -16,6 +16,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "GameWindow.h"
 
 #include "Logger.h"
+#include "Profiler.h"
 #include "Screen.h"
 
 #ifdef _WIN32
@@ -300,6 +301,7 @@ void GameWindow::Quit()
 
 void GameWindow::Step()
 {
+	Profiler::Scope profile("GameWindow::Step");
 	SDL_GL_SwapWindow(mainWindow);
 }
 
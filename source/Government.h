@@ -79,6 +79,9 @@ public:
 	void Load(const DataNode &node, const std::set<const System *> *visitedSystems,
 		const std::set<const Planet *> *visitedPlanets);
 
+	// Get the unique number of this government, for indexing tables of data
+	// about every government.
+	unsigned Id() const;
 	// Get the display name of this government.
 	const std::string &DisplayName() const;
 	// Set / Get the true name used for this government in the data files.
@@ -231,3 +234,10 @@ private:
 	// action instead of this government's own penalties.
 	std::set<unsigned> useForeignPenaltiesFor;
 };
+
+
+
+inline unsigned Government::Id() const
+{
+	return id;
+}
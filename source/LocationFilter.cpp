@@ -19,7 +19,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "CategoryType.h"
 #include "DataNode.h"
 #include "DataWriter.h"
-#include "DistanceMap.h"
+#include "DistanceTable.h"
 #include "GameData.h"
 #include "Government.h"
 #include "Planet.h"
@@ -30,7 +30,6 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "System.h"
 
 #include <algorithm>
-#include <mutex>
 
 using namespace std;
 
@@ -74,37 +73,8 @@ namespace {
 	// Check if the given system is within the given distance of the center.
 	int Distance(const System *center, const System *system, int maximum, DistanceCalculationSettings distanceSettings)
 	{
-		// This function should only ever be called from the main thread, but
-		// just to be sure, use mutex protection on the static locals.
-		static mutex distanceMutex;
-		lock_guard<mutex> lock(distanceMutex);
-
-		static const System *previousCenter = center;
-		static DistanceMap distance(
-			center,
-			distanceSettings.WormholeStrat(),
-			distanceSettings.AssumesJumpDrive(),
-			-1,
-			maximum
-		);
-		static int previousMaximum = maximum;
-		static DistanceCalculationSettings previousDistanceSettings = distanceSettings;
-
-		if(center != previousCenter || maximum > previousMaximum || distanceSettings != previousDistanceSettings)
-		{
-			previousCenter = center;
-			previousMaximum = maximum;
-			previousDistanceSettings = distanceSettings;
-			distance = DistanceMap(
-				center,
-				distanceSettings.WormholeStrat(),
-				distanceSettings.AssumesJumpDrive(),
-				-1,
-				maximum
-			);
-		}
 		// If the distance is greater than the maximum, this is not a match.
-		int d = distance.Days(*system);
+		int d = GameData::Distances().Days(*center, *system, distanceSettings);
 		return (d > maximum) ? -1 : d;
 	}
 
@@ -294,6 +264,13 @@ bool LocationFilter::IsEmpty() const
 
 
 
+const set<const Planet *> &LocationFilter::Planets() const
+{
+	return planets;
+}
+
+
+
 // Check if all of this filter's named content is invalid (e.g. its known members only
 // match to content that is currently unavailable). If at least one valid parameter
 // from every restriction is valid, then this filter is valid.
@@ -52,6 +52,9 @@ public:
 	// Check if this filter contains any specifications.
 	bool IsEmpty() const;
 	bool IsValid() const;
+	// Get the planets this filter is limited to. If this is empty, the filter
+	// is not limited to specific planets.
+	const std::set<const Planet *> &Planets() const;
 
 	// If the player is in the given system, does this filter match?
 	bool Matches(const Planet *planet, const System *origin = nullptr) const;
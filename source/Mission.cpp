@@ -19,6 +19,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "DataWriter.h"
 #include "DialogPanel.h"
 #include "DistanceMap.h"
+#include "DistanceTable.h"
 #include "Endpoint.h"
 #include "text/Format.h"
 #include "GameData.h"
@@ -763,6 +764,26 @@ bool Mission::IsAtLocation(Location location) const
 
 
 
+bool Mission::SourcePlanets(set<const Planet *> &planets) const
+{
+	planets.clear();
+	if(source)
+		planets.insert(source);
+	else
+		planets = sourceFilter.Planets();
+	return !planets.empty();
+}
+
+
+
+bool Mission::IsNeverOffered() const
+{
+	// An offer condition that does not read any conditions always has the same value.
+	return !toOffer.IsEmpty() && toOffer.RelevantConditions().empty() && !toOffer.Test();
+}
+
+
+
 // Information about what you are doing.
 const Ship *Mission::SourceShip() const
 {
@@ -1784,20 +1805,22 @@ int Mission::CalculateJumps(const System *sourceSystem)
 	for(const Planet *planet : stopovers)
 		destinations.push_back(planet->GetSystem());
 
+	DistanceTable &distances = GameData::Distances();
+	auto Days = [this, &distances](const System *from, const System &to) -> int
+	{
+		return from ? distances.Days(*from, to, distanceCalcSettings) : -1;
+	};
 	while(!destinations.empty())
 	{
 		// Find the closest destination to this location.
-		DistanceMap distance(sourceSystem,
-				distanceCalcSettings.WormholeStrat(),
-				distanceCalcSettings.AssumesJumpDrive());
 		auto it = destinations.begin();
 		auto bestIt = it;
-		int bestDays = distance.Days(**bestIt);
+		int bestDays = Days(sourceSystem, **bestIt);
 		if(bestDays < 0)
 			bestDays = numeric_limits<int>::max();
 		for(++it; it != destinations.end(); ++it)
 		{
-			int days = distance.Days(**it);
+			int days = Days(sourceSystem, **it);
 			if(days >= 0 && days < bestDays)
 			{
 				bestIt = it;
@@ -1810,11 +1833,8 @@ int Mission::CalculateJumps(const System *sourceSystem)
 		expectedJumps += bestDays == numeric_limits<int>::max() ? -1 : bestDays;
 		destinations.erase(bestIt);
 	}
-	DistanceMap distance(sourceSystem,
-			distanceCalcSettings.WormholeStrat(),
-			distanceCalcSettings.AssumesJumpDrive());
 	// If currently unreachable, this system adds -1 to the deadline, to match previous behavior.
-	expectedJumps += distance.Days(*destination->GetSystem());
+	expectedJumps += Days(sourceSystem, *destination->GetSystem());
 
 	return expectedJumps;
 }
@@ -107,6 +107,13 @@ public:
 	// Find out where this mission is offered.
 	enum Location {SPACEPORT, LANDING, JOB, ASSISTING, BOARDING, SHIPYARD, OUTFITTER, JOB_BOARD, ENTERING, TRANSITION};
 	bool IsAtLocation(Location location) const;
+	// Get the planets this mission may be offered on, if it is limited to
+	// specific planets. Returns false if it may be offered on any planet that
+	// matches its source filter.
+	bool SourcePlanets(std::set<const Planet *> &planets) const;
+	// Check if this mission can never be offered, regardless of the player's
+	// conditions (e.g. because it was disabled).
+	bool IsNeverOffered() const;
 
 	// Information about what you are doing.
 	const Ship *SourceShip() const;
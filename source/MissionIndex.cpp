@@ -0,0 +1,95 @@
+/* MissionIndex.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "MissionIndex.h"
+
+#include "Mission.h"
+
+#include <set>
+
+using namespace std;
+
+
+
+void MissionIndex::Update(const Set<Mission> &missions)
+{
+	if(indexedSize == missions.size())
+		return;
+
+	Clear();
+	indexedSize = missions.size();
+	set<const Planet *> planets;
+	for(const auto &it : missions)
+	{
+		const Mission &mission = it.second;
+		// Only the missions offered when landing are indexed.
+		if(mission.IsAtLocation(Mission::BOARDING) || mission.IsAtLocation(Mission::ASSISTING)
+				|| mission.IsAtLocation(Mission::ENTERING) || mission.IsAtLocation(Mission::TRANSITION))
+			continue;
+		if(mission.IsNeverOffered())
+			continue;
+
+		const size_t index = this->missions.size();
+		this->missions.push_back(&mission);
+		if(mission.SourcePlanets(planets))
+			for(const Planet *planet : planets)
+				byPlanet[planet].push_back(index);
+		else
+			anywhere.push_back(index);
+	}
+}
+
+
+
+void MissionIndex::Clear()
+{
+	missions.clear();
+	anywhere.clear();
+	byPlanet.clear();
+	candidates.clear();
+	indexedSize = -1;
+}
+
+
+
+const vector<const Mission *> &MissionIndex::Candidates(const Planet *planet)
+{
+	candidates.clear();
+	// No mission can be offered when landing without a planet to land on.
+	if(!planet)
+		return candidates;
+
+	// Merge the missions limited to this planet with the ones that may be
+	// offered anywhere, keeping them in their original order.
+	auto it = byPlanet.find(planet);
+	if(it == byPlanet.end())
+	{
+		for(size_t index : anywhere)
+			candidates.push_back(missions[index]);
+		return candidates;
+	}
+
+	const vector<size_t> &here = it->second;
+	auto hit = here.begin();
+	auto ait = anywhere.begin();
+	while(hit != here.end() || ait != anywhere.end())
+	{
+		if(ait == anywhere.end() || (hit != here.end() && *hit < *ait))
+			candidates.push_back(missions[*hit++]);
+		else
+			candidates.push_back(missions[*ait++]);
+	}
+	return candidates;
+}
@@ -0,0 +1,59 @@
+/* MissionIndex.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Set.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+class Mission;
+class Planet;
+
+
+
+// An index of the missions that may be offered when the player lands, grouped
+// by the planets they are limited to. When landing, only the missions that are
+// not limited to specific planets and the ones limited to that planet need to
+// be checked, instead of every mission in the game. Missions that can never be
+// offered, and ones that are offered elsewhere (e.g. when boarding a ship), are
+// not included at all.
+class MissionIndex {
+public:
+	// Index the given missions, unless they are already indexed. New missions
+	// are detected automatically; call Clear() if any mission was redefined.
+	void Update(const Set<Mission> &missions);
+	void Clear();
+
+	// Get the missions that may be offered when landing on the given planet,
+	// in the same order as they are in the game data. Any mission that is not
+	// included here can not be offered on that planet.
+	const std::vector<const Mission *> &Candidates(const Planet *planet);
+
+
+private:
+	// All missions that can be offered when landing, in the order they were
+	// defined in, and the indices of the ones that can be offered anywhere.
+	std::vector<const Mission *> missions;
+	std::vector<size_t> anywhere;
+	// The indices of the missions limited to each planet.
+	std::map<const Planet *, std::vector<size_t>> byPlanet;
+	int indexedSize = -1;
+
+	// Reusable storage for the candidates on the current planet.
+	std::vector<const Mission *> candidates;
+};
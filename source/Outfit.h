@@ -73,6 +73,7 @@ public:
 
 	double Get(const char *attribute) const;
 	double Get(const std::string &attribute) const;
+	double Get(const Dictionary::Key &attribute) const;
 	const Dictionary &Attributes() const;
 
 	// Determine whether the given number of instances of the given outfit can
@@ -174,4 +175,5 @@ private:
 // These get called a lot, so inline them for speed.
 inline int64_t Outfit::Cost() const { return cost; }
 inline double Outfit::Mass() const { return mass; }
+inline double Outfit::Get(const Dictionary::Key &attribute) const { return attributes.Get(attribute); }
 inline const std::shared_ptr<const Weapon> &Outfit::GetWeapon() const { return weapon; }
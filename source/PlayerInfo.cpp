@@ -22,6 +22,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "DataWriter.h"
 #include "DialogPanel.h"
 #include "DistanceMap.h"
+#include "DistanceTable.h"
 #include "Endpoint.h"
 #include "Files.h"
 #include "text/Format.h"
@@ -30,6 +31,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Government.h"
 #include "Logger.h"
 #include "Messages.h"
+#include "MissionIndex.h"
 #include "Outfit.h"
 #include "Person.h"
 #include "Planet.h"
@@ -155,6 +157,30 @@ namespace {
 
 
 
+	// Check that none of the missions left out of the given candidates could have
+	// been offered, by checking every mission as was done before the index existed.
+	// Note that this may use up random numbers when checking the missions' conditions.
+	void VerifyMissionCandidates(const PlayerInfo &player, const vector<const Mission *> &candidates, bool skipJobs)
+	{
+		const set<const Mission *> checked(candidates.begin(), candidates.end());
+		for(const auto &[name, mission] : GameData::Missions())
+		{
+			if(checked.contains(&mission))
+				continue;
+			if(mission.IsAtLocation(Mission::BOARDING) || mission.IsAtLocation(Mission::ASSISTING)
+					|| mission.IsAtLocation(Mission::ENTERING) || mission.IsAtLocation(Mission::TRANSITION))
+				continue;
+			if(skipJobs && mission.IsAtLocation(Mission::JOB))
+				continue;
+
+			if(mission.CanOffer(player))
+				Logger::Log("Mission \"" + name + "\" can be offered on \"" + player.GetPlanet()->TrueName()
+					+ "\", but it was not found in the mission index.", Logger::Level::WARNING);
+		}
+	}
+
+
+
 PlayerInfo::ScheduledEvent::ScheduledEvent(const DataNode &node, const ConditionsStore *playerConditions)
 {
 	GameEvent nodeEvent(node, playerConditions);
@@ -645,6 +671,12 @@ void PlayerInfo::AddChanges(list<DataNode> &changes, bool instantChanges)
 {
 	bool changedPlanets = false;
 	bool changedSystems = false;
+	// Track which cached jump routes may no longer be valid. Removing a link can
+	// only affect the routes through the two systems it connected, and changing a
+	// planet can only affect routes if it is a wormhole. Anything else may create
+	// a shortcut that any route could now take.
+	bool changedAllRoutes = false;
+	set<const System *> changedRouteSystems;
 	for(const DataNode &change : changes)
 	{
 		const string &key = change.Token(0);
@@ -653,7 +685,24 @@ void PlayerInfo::AddChanges(list<DataNode> &changes, bool instantChanges)
 			continue;
 		changedPlanets |= (key == "planet" || key == "wormhole");
 		changedSystems |= (key == "system" || key == "link" || key == "unlink");
+		const Planet *planet = (key == "planet" && change.Size() >= 2)
+			? GameData::Planets().Find(change.Token(1)) : nullptr;
+		const bool wasWormhole = planet && planet->IsWormhole();
 		GameData::Change(change, *this);
+
+		if(key == "unlink" && change.Size() >= 3)
+		{
+			changedRouteSystems.insert(GameData::Systems().Find(change.Token(1)));
+			changedRouteSystems.insert(GameData::Systems().Find(change.Token(2)));
+		}
+		else if(key == "planet")
+		{
+			if(!planet)
+				planet = GameData::Planets().Find(change.Token(1));
+			changedAllRoutes |= wasWormhole || !planet || planet->IsWormhole();
+		}
+		else
+			changedAllRoutes |= (key == "system" || key == "link" || key == "wormhole" || key == "event");
 	}
 	if(changedPlanets)
 		GameData::RecomputeWormholeRequirements();
@@ -674,7 +723,13 @@ void PlayerInfo::AddChanges(list<DataNode> &changes, bool instantChanges)
 		if(instantChanges)
 			CacheMissionInformation(true);
 	}
-	recacheJumpRoutes = instantChanges && (changedPlanets || changedSystems);
+	if(instantChanges)
+	{
+		recacheAllJumpRoutes |= changedAllRoutes;
+		if(!recacheAllJumpRoutes)
+			recacheJumpRouteSystems.insert(changedRouteSystems.begin(), changedRouteSystems.end());
+		recacheJumpRouteSystems.erase(nullptr);
+	}
 }
 
 
@@ -4313,10 +4368,7 @@ void PlayerInfo::RegisterDerivedConditions()
 		if(!origin)
 			return -1;
 
-		auto distanceMap = DistanceMap(origin);
-		if(!distanceMap.HasRoute(*destination))
-			return -1;
-		return distanceMap.Days(*destination);
+		return GameData::Distances().Days(*origin, *destination, WormholeStrategy::NONE, false);
 	};
 
 	conditions["hyperjumps to system: "].ProvidePrefixed([this, HyperspaceTravelDays](const ConditionEntry &ce) -> int {
@@ -4464,11 +4516,13 @@ void PlayerInfo::CreateMissions()
 	bool skipJobs = planet && !planet->GetPort().HasService(Port::ServicesType::JobBoard);
 	bool hasPriorityMissions = false;
 	unsigned nonBlockingMissions = 0;
-	for(const auto &[name, mission] : GameData::Missions())
+	// Only the missions that may be offered on this planet need to be checked.
+	const vector<const Mission *> &candidates = GameData::GetMissionIndex().Candidates(planet);
+	if(planet && GameData::IsDebugMode())
+		VerifyMissionCandidates(*this, candidates, skipJobs);
+	for(const Mission *candidate : candidates)
 	{
-		if(mission.IsAtLocation(Mission::BOARDING) || mission.IsAtLocation(Mission::ASSISTING)
-				|| mission.IsAtLocation(Mission::ENTERING) || mission.IsAtLocation(Mission::TRANSITION))
-			continue;
+		const Mission &mission = *candidate;
 		if(skipJobs && mission.IsAtLocation(Mission::JOB))
 			continue;
 
@@ -4601,10 +4655,14 @@ void PlayerInfo::StepMissionTimers(UI &ui)
 
 
 
-bool PlayerInfo::RecacheJumpRoutes()
+bool PlayerInfo::RecacheJumpRoutes(set<const System *> &systems)
 {
-	bool recache = recacheJumpRoutes;
-	recacheJumpRoutes = false;
+	systems.clear();
+	bool recache = recacheAllJumpRoutes || !recacheJumpRouteSystems.empty();
+	if(!recacheAllJumpRoutes)
+		systems.swap(recacheJumpRouteSystems);
+	recacheAllJumpRoutes = false;
+	recacheJumpRouteSystems.clear();
 	return recache;
 }
 
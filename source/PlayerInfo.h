@@ -384,8 +384,10 @@ public:
 
 	// Advance any active mission timers that meet the right criteria.
 	void StepMissionTimers(UI &ui);
-	// Checks and resets recacheJumpRoutes. Returns the value that was present upon entry.
-	bool RecacheJumpRoutes();
+	// Check whether any cached jump routes need to be recalculated, and reset
+	// that state. If only the routes through certain systems are affected, they
+	// are returned in the given set; if it is empty, all routes are affected.
+	bool RecacheJumpRoutes(std::set<const System *> &systems);
 
 
 private:
@@ -568,5 +570,8 @@ private:
 
 	std::unique_ptr<DataWriter> transactionSnapshot;
 
-	bool recacheJumpRoutes = false;
+	// Whether all cached jump routes must be recalculated, or otherwise the
+	// systems that the affected routes pass through.
+	bool recacheAllJumpRoutes = false;
+	std::set<const System *> recacheJumpRouteSystems;
 };
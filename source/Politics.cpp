@@ -71,11 +71,28 @@ void Politics::Reset()
 	// were already checked for when you first landed).
 	for(const auto &it : GameData::Governments())
 		fined.insert(&it.second);
+
+	UpdateHostility(GameData::Governments());
+}
+
+
+
+void Politics::UpdateHostility(const Set<Government> &governments)
+{
+	hostilityStride = 0;
+	for(const auto &it : governments)
+		hostilityStride = max<size_t>(hostilityStride, it.second.Id() + 1);
+
+	hostility.assign(hostilityStride * hostilityStride, false);
+	for(const auto &first : governments)
+		for(const auto &second : governments)
+			hostility[first.second.Id() * hostilityStride + second.second.Id()]
+				= CheckIsEnemy(&first.second, &second.second);
 }
 
 
 
-bool Politics::IsEnemy(const Government *first, const Government *second) const
+bool Politics::CheckIsEnemy(const Government *first, const Government *second) const
 {
 	if(!first || !second)
 		return false;
@@ -133,6 +150,7 @@ void Politics::Offend(const Government *gov, int eventType, int count)
 				// your bribe is canceled out.
 				bribed.erase(other);
 				provoked.insert(other);
+				UpdateHostility(other);
 			}
 		}
 		if(count && abs(weight) >= .05)
@@ -158,6 +176,7 @@ void Politics::Bribe(const Government *gov)
 	bribed.insert(gov);
 	provoked.erase(gov);
 	fined.insert(gov);
+	UpdateHostility(gov);
 }
 
 
@@ -420,6 +439,7 @@ void Politics::SetReputation(const Government *gov, double value)
 	value = min(value, gov->ReputationMax());
 	value = max(value, gov->ReputationMin());
 	reputationWith[gov] = value;
+	UpdateHostility(gov);
 }
 
 
@@ -427,8 +447,31 @@ void Politics::SetReputation(const Government *gov, double value)
 // Reset any temporary provocation (typically because a day has passed).
 void Politics::ResetDaily()
 {
-	provoked.clear();
+	set<const Government *> changed;
+	changed.swap(provoked);
+	changed.merge(bribed);
 	bribed.clear();
 	bribedPlanets.clear();
 	fined.clear();
+
+	for(const Government *gov : changed)
+		UpdateHostility(gov);
+}
+
+
+
+void Politics::UpdateHostility(const Government *gov)
+{
+	const Government *player = GameData::PlayerGovernment();
+	if(!gov || !player)
+		return;
+
+	const size_t govId = gov->Id();
+	const size_t playerId = player->Id();
+	if(govId >= hostilityStride || playerId >= hostilityStride)
+		return;
+
+	const bool isEnemy = CheckIsEnemy(player, gov);
+	hostility[playerId * hostilityStride + govId] = isEnemy;
+	hostility[govId * hostilityStride + playerId] = isEnemy;
 }
@@ -15,12 +15,16 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include "Government.h"
+#include "Set.h"
+
+#include <cstddef>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 class Conversation;
-class Government;
 class Planet;
 class PlayerInfo;
 class Ship;
@@ -36,7 +40,13 @@ public:
 	// Reset to the initial political state defined in the game data.
 	void Reset();
 
+	// Check whether the given governments are hostile to each other. This is
+	// looked up in a table that is updated whenever the player's standing
+	// with a government changes.
 	bool IsEnemy(const Government *first, const Government *second) const;
+	// Rebuild the whole hostility table for the given governments. This must be
+	// done whenever any government's attitudes toward the others may have changed.
+	void UpdateHostility(const Set<Government> &governments);
 
 	// Commit the given "offense" against the given government (which may not
 	// actually consider it to be an offense). This may result in temporary
@@ -73,6 +83,13 @@ public:
 	void ResetDaily();
 
 
+private:
+	// Determine whether the given governments are hostile without the table.
+	bool CheckIsEnemy(const Government *first, const Government *second) const;
+	// Update the table for the player's relationship with the given government.
+	void UpdateHostility(const Government *gov);
+
+
 private:
 	// attitude[target][other] stores how much an action toward the given target
 	// government will affect your reputation with the given other government.
@@ -85,4 +102,25 @@ private:
 	std::map<const Planet *, bool> bribedPlanets;
 	std::set<const Planet *> dominatedPlanets;
 	std::set<const Government *> fined;
+
+	// Whether each government is an enemy of each other one, indexed by
+	// their IDs as hostility[first * hostilityStride + second].
+	std::vector<bool> hostility;
+	size_t hostilityStride = 0;
 };
+
+
+
+// Inline the hostility check because it gets called so frequently.
+inline bool Politics::IsEnemy(const Government *first, const Government *second) const
+{
+	if(!first || !second)
+		return false;
+
+	// Governments created since the table was built are not in it.
+	const size_t firstId = first->Id();
+	const size_t secondId = second->Id();
+	if(firstId >= hostilityStride || secondId >= hostilityStride)
+		return CheckIsEnemy(first, second);
+	return hostility[firstId * hostilityStride + secondId];
+}
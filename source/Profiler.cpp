@@ -0,0 +1,214 @@
+/* Profiler.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Profiler.h"
+
+#include "Files.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+namespace {
+	// How many records each thread keeps. A frame records about a dozen scopes,
+	// so this holds the last several seconds of the game.
+	const size_t BUFFER_SIZE = 16384;
+
+	struct Record {
+		atomic<const char *> name;
+		atomic<int64_t> start;
+		atomic<int64_t> end;
+	};
+
+	// The records of a single thread. Only that thread writes to it, and it
+	// publishes each record by incrementing the count afterwards. A reader
+	// checks the count again after copying the records, and drops any that
+	// may have been overwritten in the meantime. For that check to work, a
+	// reader that sees any part of a new record must also see the count that
+	// was stored before it, so the writer fences between the two.
+	struct Buffer {
+		explicit Buffer(int thread) : thread(thread) {}
+
+		const int thread;
+		atomic<uint64_t> count = 0;
+		Record records[BUFFER_SIZE];
+	};
+
+	struct Copy {
+		const char *name;
+		int64_t start;
+		int64_t end;
+		int thread;
+	};
+
+	atomic<bool> isEnabled = false;
+	const chrono::steady_clock::time_point epoch = chrono::steady_clock::now();
+
+	// The buffers of every thread that has recorded anything. They are never
+	// freed, so a buffer stays readable after its thread exits.
+	mutex buffersMutex;
+	vector<unique_ptr<Buffer>> buffers;
+	thread_local Buffer *threadBuffer = nullptr;
+
+	int64_t Now()
+	{
+		return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - epoch).count();
+	}
+
+	Buffer &ThreadBuffer()
+	{
+		if(!threadBuffer)
+		{
+			lock_guard<mutex> lock(buffersMutex);
+			buffers.emplace_back(make_unique<Buffer>(buffers.size() + 1));
+			threadBuffer = buffers.back().get();
+		}
+		return *threadBuffer;
+	}
+
+	// Copy every complete record out of the buffers.
+	vector<Copy> CopyRecords()
+	{
+		vector<Copy> result;
+		lock_guard<mutex> lock(buffersMutex);
+		for(const unique_ptr<Buffer> &buffer : buffers)
+		{
+			const uint64_t count = buffer->count.load(memory_order_acquire);
+			const uint64_t first = count > BUFFER_SIZE ? count - BUFFER_SIZE : 0;
+			const size_t begin = result.size();
+			for(uint64_t i = first; i < count; ++i)
+			{
+				const Record &record = buffer->records[i % BUFFER_SIZE];
+				result.push_back({record.name.load(memory_order_relaxed), record.start.load(memory_order_relaxed),
+					record.end.load(memory_order_relaxed), buffer->thread});
+			}
+			// Any record that the thread has started writing since then may be torn.
+			atomic_thread_fence(memory_order_acquire);
+			const uint64_t newCount = buffer->count.load(memory_order_relaxed);
+			const uint64_t overwritten = newCount + 1 > first + BUFFER_SIZE ? newCount + 1 - first - BUFFER_SIZE : 0;
+			result.erase(result.begin() + begin, result.begin() + begin + min<uint64_t>(overwritten, count - first));
+		}
+		return result;
+	}
+
+	void WriteEscaped(ostream &out, const char *str)
+	{
+		for( ; *str; ++str)
+		{
+			if(*str == '"' || *str == '\\')
+				out << '\\';
+			out << *str;
+		}
+	}
+}
+
+
+
+Profiler::Scope::Scope(const char *name) noexcept
+	: name(name), start(isEnabled.load(memory_order_relaxed) ? Now() : -1)
+{
+}
+
+
+
+Profiler::Scope::~Scope() noexcept
+{
+	if(start < 0)
+		return;
+
+	Buffer &buffer = ThreadBuffer();
+	const uint64_t count = buffer.count.load(memory_order_relaxed);
+	// Keep the writes to this record from becoming visible before the count
+	// that published the previous one.
+	atomic_thread_fence(memory_order_release);
+	Record &record = buffer.records[count % BUFFER_SIZE];
+	record.name.store(name, memory_order_relaxed);
+	record.start.store(start, memory_order_relaxed);
+	record.end.store(Now(), memory_order_relaxed);
+	buffer.count.store(count + 1, memory_order_release);
+}
+
+
+
+void Profiler::SetEnabled(bool enabled)
+{
+	isEnabled.store(enabled, memory_order_relaxed);
+}
+
+
+
+bool Profiler::IsEnabled()
+{
+	return isEnabled.load(memory_order_relaxed);
+}
+
+
+
+vector<Profiler::Summary> Profiler::Summarize(chrono::steady_clock::time_point since)
+{
+	const int64_t sinceTime = chrono::duration_cast<chrono::nanoseconds>(since - epoch).count();
+	map<string, Summary> totals;
+	for(const Copy &record : CopyRecords())
+		if(record.end >= sinceTime)
+		{
+			Summary &summary = totals[record.name];
+			summary.time += chrono::nanoseconds(record.end - record.start);
+			++summary.count;
+		}
+
+	vector<Summary> result;
+	result.reserve(totals.size());
+	for(auto &[name, summary] : totals)
+	{
+		summary.name = name;
+		result.push_back(std::move(summary));
+	}
+	stable_sort(result.begin(), result.end(),
+		[](const Summary &a, const Summary &b) { return a.time > b.time; });
+	return result;
+}
+
+
+
+bool Profiler::WriteTrace(const filesystem::path &path)
+{
+	shared_ptr<iostream> file = Files::Open(path, true);
+	if(!file || !*file)
+		return false;
+
+	ostream &out = *file;
+	out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool isFirst = true;
+	// The trace's timestamps and durations are in microseconds.
+	out << fixed << setprecision(3);
+	for(const Copy &record : CopyRecords())
+	{
+		out << (isFirst ? "\n" : ",\n") << "{\"name\":\"";
+		WriteEscaped(out, record.name);
+		out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << record.thread
+			<< ",\"ts\":" << record.start / 1000.
+			<< ",\"dur\":" << (record.end - record.start) / 1000. << '}';
+		isFirst = false;
+	}
+	out << "\n]}\n";
+	out.flush();
+	return !out.fail();
+}
@@ -0,0 +1,68 @@
+/* Profiler.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+
+// Class for measuring where the time of each frame goes. A Scope placed at the
+// start of a block records how long that block took. Each thread records into
+// its own fixed-size ring buffer without taking any locks, so only the most
+// recent records are kept. While the profiler is disabled, a Scope does nothing
+// beyond checking whether it is enabled.
+class Profiler {
+public:
+	// A timer for the rest of the block that it is created in. The name must be a
+	// string literal (or otherwise outlive the profiler), because only the pointer
+	// to it is recorded.
+	class Scope {
+	public:
+		explicit Scope(const char *name) noexcept;
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+		~Scope() noexcept;
+
+	private:
+		const char *name;
+		// The start time in nanoseconds, or -1 if the profiler was disabled then.
+		int64_t start;
+	};
+
+	// The total time recorded by all scopes with the same name.
+	struct Summary {
+		std::string name;
+		std::chrono::nanoseconds time{};
+		int count = 0;
+	};
+
+
+public:
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	// Add up the time of every scope that ended after the given time, sorted
+	// with the longest total time first.
+	static std::vector<Summary> Summarize(std::chrono::steady_clock::time_point since);
+	// Write all the records that are still in the buffers to the given file as
+	// Chrome trace events, which can be viewed in e.g. chrome://tracing or Perfetto.
+	// Returns false if the file could not be written.
+	static bool WriteTrace(const std::filesystem::path &path);
+};
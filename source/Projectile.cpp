@@ -80,6 +80,8 @@ Projectile::Projectile(const Ship &parent, Point position, Angle angle, const We
 		CheckLock(*cachedTarget);
 		CheckConfused(*cachedTarget);
 	}
+
+	CacheCoasting();
 }
 
 
@@ -114,6 +116,8 @@ Projectile::Projectile(const Projectile &parent, const Point &offset, const Angl
 		CheckLock(*cachedTarget);
 		CheckConfused(*cachedTarget);
 	}
+
+	CacheCoasting();
 }
 
 
@@ -165,20 +169,7 @@ void Projectile::Move(vector<Visual> &visuals, vector<Projectile> &projectiles)
 		if(!Random::Int(it.second))
 			visuals.emplace_back(*it.first, position, velocity, angle);
 
-	// If the target has left the system, stop following it. Also stop if the
-	// target has been captured by a different government.
-	// Also stop targeting fighters that have become disabled after this projectile was fired.
-	const Ship *target = cachedTarget;
-	if(target)
-	{
-		target = TargetPtr().get();
-		if(!target || !target->IsTargetable() || target->GetGovernment() != targetGovernment ||
-				(!targetDisabled && !FighterHitHelper::IsValidTarget(target)))
-		{
-			BreakTarget();
-			target = nullptr;
-		}
-	}
+	const Ship *target = UpdateTarget();
 
 	double turn = weapon->Turn();
 	double accel = weapon->Acceleration();
@@ -292,6 +283,32 @@ void Projectile::Move(vector<Visual> &visuals, vector<Projectile> &projectiles)
 
 
 
+// Move all of the given projectiles. Projectiles that neither steer, accelerate,
+// nor spawn live effects simply coast in a straight line, so while they are not
+// about to die they are advanced here without consulting their weapon at all.
+// Everything else falls back to Move(), with identical results either way.
+void Projectile::MoveAll(vector<Projectile> &projectiles, vector<Visual> &visuals,
+	vector<Projectile> &newProjectiles)
+{
+	for(Projectile &projectile : projectiles)
+	{
+		if(!projectile.isCoasting || projectile.lifetime <= 1)
+		{
+			projectile.Move(visuals, newProjectiles);
+			continue;
+		}
+
+		--projectile.lifetime;
+		projectile.UpdateTarget();
+		projectile.position += projectile.velocity;
+		projectile.distanceTraveled += projectile.coastSpeed;
+		if(projectile.lifetime < projectile.fadeOut)
+			projectile.alpha = static_cast<double>(projectile.lifetime) / projectile.fadeOut;
+	}
+}
+
+
+
 // This projectile hit something. Create the explosion, if any. This also
 // marks the projectile as needing deletion if it has run out of hits.
 void Projectile::Explode(vector<Visual> &visuals, double intersection, Point hitVelocity)
@@ -398,6 +415,40 @@ void Projectile::BreakTarget()
 
 
 
+// If the target has left the system, stop following it. Also stop if the
+// target has been captured by a different government.
+// Also stop targeting fighters that have become disabled after this projectile was fired.
+// Returns the target, if this projectile still has one.
+const Ship *Projectile::UpdateTarget()
+{
+	const Ship *target = cachedTarget;
+	if(target)
+	{
+		target = TargetPtr().get();
+		if(!target || !target->IsTargetable() || target->GetGovernment() != targetGovernment ||
+				(!targetDisabled && !FighterHitHelper::IsValidTarget(target)))
+		{
+			BreakTarget();
+			target = nullptr;
+		}
+	}
+	return target;
+}
+
+
+
+// Cache what is needed to move this projectile without consulting its weapon,
+// if it will only ever coast in a straight line.
+void Projectile::CacheCoasting()
+{
+	isCoasting = !weapon->Turn() && !weapon->Acceleration() && !weapon->Homing()
+		&& !weapon->SplitRange() && weapon->LiveEffects().empty();
+	coastSpeed = dV.Length();
+	fadeOut = weapon->FadeOut();
+}
+
+
+
 // TODO: add more conditions in the future. For example maybe proximity to stars
 // and their brightness could could cause IR missiles to lose their locks more
 // often, and dense asteroid fields could do the same for radar and optically
@@ -67,6 +67,10 @@ public:
 
 	// Move the projectile. It may create effects or submunitions.
 	void Move(std::vector<Visual> &visuals, std::vector<Projectile> &projectiles);
+	// Move all the given projectiles, taking a faster path for the ones that
+	// just coast in a straight line. New submunitions are added to newProjectiles.
+	static void MoveAll(std::vector<Projectile> &projectiles, std::vector<Visual> &visuals,
+		std::vector<Projectile> &newProjectiles);
 	// This projectile hit something. Create the explosion, if any. This also
 	// marks the projectile as needing deletion if it has run out of penetrations.
 	void Explode(std::vector<Visual> &visuals, double intersection, Point hitVelocity = Point());
@@ -111,6 +115,8 @@ public:
 
 
 private:
+	const Ship *UpdateTarget();
+	void CacheCoasting();
 	void CheckLock(const Ship &target);
 	void CheckConfused(const Ship &target);
 
@@ -138,6 +144,12 @@ private:
 	// a negative value means this projectile will turn left.
 	int confusionDirection = 0;
 
+	// Projectiles that never steer, accelerate, or spawn live effects just coast
+	// in a straight line, always traveling the same distance each step.
+	bool isCoasting = false;
+	double coastSpeed = 0.;
+	int fadeOut = 0;
+
 	// This is safe to keep even if the ships die, because we don't actually call the ship,
 	// we just compare this pointer to other ship pointers.
 	const Ship *phasedShip;
@@ -49,6 +49,9 @@ void Random::Seed(uint64_t seed)
 	lock_guard<mutex> lock(workaroundMutex);
 #endif
 	gen.seed(seed);
+	// The normal distribution generates two numbers at a time, so it may be
+	// holding on to one that was generated from the old seed.
+	normal.reset();
 }
 
 
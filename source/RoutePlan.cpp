@@ -36,18 +36,31 @@ RoutePlan::RoutePlan(const Ship &ship, const System &destination, const PlayerIn
 
 
 
+// Find the route by continuing a search from the center system, which may
+// have been used to find the routes to other destinations already.
+RoutePlan::RoutePlan(DistanceMap &search, const System &destination, const Ship *ship)
+{
+	if(search.Continue(destination, ship))
+		Init(search);
+}
+
+
+
 void RoutePlan::Init(const DistanceMap &distance)
 {
-	auto it = distance.route.find(distance.destination);
-	if(it == distance.route.end())
+	if(!distance.destination)
+		return;
+	int index = distance.IndexOf(*distance.destination);
+	if(index < 0)
 		return;
 
 	hasRoute = true;
 
-	while(it->first != distance.center)
+	while(distance.systems[index] != distance.center)
 	{
-		plan.emplace_back(it->first, it->second);
-		it = distance.route.find(it->second.prev);
+		const RouteEdge &edge = distance.route[index];
+		plan.emplace_back(distance.systems[index], edge);
+		index = distance.IndexOf(*edge.prev);
 	}
 }
 
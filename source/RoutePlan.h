@@ -33,6 +33,11 @@ public:
 	RoutePlan() = default;
 	RoutePlan(const System &center, const System &destination, const PlayerInfo *player = nullptr);
 	RoutePlan(const Ship &ship, const System &destination, const PlayerInfo *player = nullptr);
+	// Find the route by continuing a resumable search (see DistanceMap), which
+	// is faster than starting over when finding routes to many destinations
+	// from the same system. If the search was started for a ship, a ship with
+	// the same capabilities must be given.
+	RoutePlan(DistanceMap &search, const System &destination, const Ship *ship = nullptr);
 
 	// Find out if the destination is reachable.
 	bool HasRoute() const;
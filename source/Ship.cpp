@@ -15,6 +15,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Ship.h"
 
+#include "Attribute.h"
 #include "audio/Audio.h"
 #include "CategoryList.h"
 #include "CategoryType.h"
@@ -286,27 +287,27 @@ void Ship::Load(const DataNode &node, const ConditionsStore *playerConditions)
 		else if(key == "attributes" || add)
 		{
 			if(!add)
-				baseAttributes.Load(child, playerConditions);
+				baseAttributes.Mutable().Load(child, playerConditions);
 			else
 			{
 				addAttributes = true;
-				attributes.Load(child, playerConditions);
+				attributes.Mutable().Load(child, playerConditions);
 			}
 		}
 		else if((key == "engine" || key == "reverse engine" || key == "steering engine") && child.Size() >= 3)
 		{
 			if(!hasEngine)
 			{
-				enginePoints.clear();
-				reverseEnginePoints.clear();
-				steeringEnginePoints.clear();
+				enginePoints.Mutable().clear();
+				reverseEnginePoints.Mutable().clear();
+				steeringEnginePoints.Mutable().clear();
 				hasEngine = true;
 			}
 			bool reverse = (key == "reverse engine");
 			bool steering = (key == "steering engine");
 
-			vector<EnginePoint> &editPoints = (!steering && !reverse) ? enginePoints :
-				(reverse ? reverseEnginePoints : steeringEnginePoints);
+			vector<EnginePoint> &editPoints = (!steering && !reverse) ? enginePoints.Mutable() :
+				(reverse ? reverseEnginePoints.Mutable() : steeringEnginePoints.Mutable());
 			editPoints.emplace_back(Point(child.Value(1), child.Value(2)) * 0.5,
 				(child.Size() > 3 ? child.Value(3) : 1.));
 			EnginePoint &engine = editPoints.back();
@@ -490,7 +491,7 @@ void Ship::Load(const DataNode &node, const ConditionsStore *playerConditions)
 		{
 			if(!hasLeak)
 			{
-				leaks.clear();
+				leaks.Mutable().clear();
 				hasLeak = true;
 			}
 			Leak leak(GameData::Effects().Get(child.Token(1)));
@@ -498,42 +499,42 @@ void Ship::Load(const DataNode &node, const ConditionsStore *playerConditions)
 				leak.openPeriod = child.Value(2);
 			if(child.Size() >= 4)
 				leak.closePeriod = child.Value(3);
-			leaks.push_back(leak);
+			leaks.Mutable().push_back(leak);
 		}
 		else if(key == "explode" && hasValue)
 		{
 			if(!hasExplode)
 			{
-				explosionEffects.clear();
+				explosionEffects.Mutable().clear();
 				explosionTotal = 0;
 				hasExplode = true;
 			}
 			int count = (child.Size() >= 3) ? child.Value(2) : 1;
-			explosionEffects[GameData::Effects().Get(child.Token(1))] += count;
+			explosionEffects.Mutable()[GameData::Effects().Get(child.Token(1))] += count;
 			explosionTotal += count;
 		}
 		else if(key == "final explode" && hasValue)
 		{
 			if(!hasFinalExplode)
 			{
-				finalExplosions.clear();
+				finalExplosions.Mutable().clear();
 				hasFinalExplode = true;
 			}
 			int count = (child.Size() >= 3) ? child.Value(2) : 1;
-			finalExplosions[GameData::Effects().Get(child.Token(1))] += count;
+			finalExplosions.Mutable()[GameData::Effects().Get(child.Token(1))] += count;
 		}
 		else if(key == "outfits")
 		{
 			if(!hasOutfits)
 			{
-				outfits.clear();
+				outfits.Mutable().clear();
 				hasOutfits = true;
 			}
 			for(const DataNode &grand : child)
 			{
 				int count = (grand.Size() >= 2) ? grand.Value(1) : 1;
 				if(count > 0)
-					outfits[GameData::Outfits().Get(grand.Token(0))] += count;
+					outfits.Mutable()[GameData::Outfits().Get(grand.Token(0))] += count;
 				else
 					grand.PrintTrace("Skipping invalid outfit count:");
 			}
@@ -543,8 +544,8 @@ void Ship::Load(const DataNode &node, const ConditionsStore *playerConditions)
 			if(!hasArmament)
 				for(const auto &pair : GetEquipped(Weapons()))
 				{
-					auto it = outfits.find(pair.first);
-					if(it == outfits.end() || it->second < pair.second)
+					auto it = outfits->find(pair.first);
+					if(it == outfits->end() || it->second < pair.second)
 					{
 						armament.UninstallAll();
 						break;
@@ -578,10 +579,10 @@ void Ship::Load(const DataNode &node, const ConditionsStore *playerConditions)
 		{
 			if(!hasDescription)
 			{
-				description.Clear();
+				description.Mutable().Clear();
 				hasDescription = true;
 			}
-			description.Load(child, playerConditions);
+			description.Mutable().Load(child, playerConditions);
 		}
 		else if(key == "formation" && hasValue)
 			formationPattern = GameData::Formations().Get(child.Token(1));
@@ -646,27 +647,27 @@ void Ship::FinishLoading(bool isNewInstance)
 			reinterpret_cast<Body &>(*this) = *base;
 		if(customSwizzleName.empty())
 			customSwizzleName = base->CustomSwizzleName();
-		if(baseAttributes.Attributes().empty())
+		if(baseAttributes->Attributes().empty())
 			baseAttributes = base->baseAttributes;
 		if(bays.empty() && !base->bays.empty() && !removeBays)
 			bays = base->bays;
-		if(enginePoints.empty())
+		if(enginePoints->empty())
 			enginePoints = base->enginePoints;
-		if(reverseEnginePoints.empty())
+		if(reverseEnginePoints->empty())
 			reverseEnginePoints = base->reverseEnginePoints;
-		if(steeringEnginePoints.empty())
+		if(steeringEnginePoints->empty())
 			steeringEnginePoints = base->steeringEnginePoints;
-		if(explosionEffects.empty())
+		if(explosionEffects->empty())
 		{
 			explosionEffects = base->explosionEffects;
 			explosionTotal = base->explosionTotal;
 		}
-		if(finalExplosions.empty())
+		if(finalExplosions->empty())
 			finalExplosions = base->finalExplosions;
-		const bool inheritsOutfits = outfits.empty();
+		const bool inheritsOutfits = outfits->empty();
 		if(inheritsOutfits)
 			outfits = base->outfits;
-		if(description.IsEmpty())
+		if(description->IsEmpty())
 			description = base->description;
 
 		bool hasHardpoints = false;
@@ -720,8 +721,8 @@ void Ship::FinishLoading(bool isNewInstance)
 	auto equipped = GetEquipped(Weapons());
 	for(auto &it : equipped)
 	{
-		auto outfitIt = outfits.find(it.first);
-		int amount = (outfitIt != outfits.end() ? outfitIt->second : 0);
+		auto outfitIt = outfits->find(it.first);
+		int amount = (outfitIt != outfits->end() ? outfitIt->second : 0);
 		int excess = it.second - amount;
 		if(excess > 0)
 		{
@@ -743,31 +744,31 @@ void Ship::FinishLoading(bool isNewInstance)
 
 	// Mark any drone that has no "automaton" value as an automaton, to
 	// grandfather in the drones from before that attribute existed.
-	if(baseAttributes.Category() == "Drone" && !baseAttributes.Get("automaton"))
-		baseAttributes.Set("automaton", 1.);
+	if(baseAttributes->Category() == "Drone" && !baseAttributes->Get("automaton"))
+		baseAttributes.Mutable().Set("automaton", 1.);
 
-	baseAttributes.Set("gun ports", armament.GunCount());
-	baseAttributes.Set("turret mounts", armament.TurretCount());
+	baseAttributes.Mutable().Set("gun ports", armament.GunCount());
+	baseAttributes.Mutable().Set("turret mounts", armament.TurretCount());
 
 	if(addAttributes)
 	{
 		// Store attributes from an "add attributes" node in the ship's
 		// baseAttributes so they can be written to the save file.
-		baseAttributes.Add(attributes);
-		baseAttributes.AddLicenses(attributes);
+		baseAttributes.Mutable().Add(*attributes);
+		baseAttributes.Mutable().AddLicenses(*attributes);
 		addAttributes = false;
 	}
 	// Add the attributes of all your outfits to the ship's base attributes.
 	attributes = baseAttributes;
 	vector<string> undefinedOutfits;
-	for(const auto &it : outfits)
+	for(const auto &it : *outfits)
 	{
 		if(!it.first->IsDefined())
 		{
 			undefinedOutfits.emplace_back("\"" + it.first->TrueName() + "\"");
 			continue;
 		}
-		attributes.Add(*it.first, it.second);
+		attributes.Mutable().Add(*it.first, it.second);
 		// Some ship variant definitions do not specify which weapons
 		// are placed in which hardpoint. Add any weapons that are not
 		// yet installed to the ship's armament.
@@ -829,7 +830,7 @@ void Ship::FinishLoading(bool isNewInstance)
 			Logger::Log(warning, Logger::Level::WARNING);
 		}
 	}
-	cargo.SetSize(attributes.Get("cargo space"));
+	cargo.SetSize(attributes->Get("cargo space"));
 	armament.FinishLoading();
 
 	// Figure out how far from center the farthest hardpoint is.
@@ -840,6 +841,9 @@ void Ship::FinishLoading(bool isNewInstance)
 	// Allocate enough firing bits for this ship.
 	firingCommands.SetHardpoints(armament.Get().size());
 
+	// Cache the stats derived from the attributes before anything uses them.
+	derivedStats.Calibrate(*attributes);
+
 	// If this ship is being instantiated for the first time, make sure its
 	// crew, fuel, etc. are all refilled.
 	if(isNewInstance)
@@ -865,20 +869,21 @@ void Ship::FinishLoading(bool isNewInstance)
 			bay.launchEffects.emplace_back(GameData::Effects().Get("basic launch"));
 	}
 
-	canBeCarried = bayCategories.Contains(attributes.Category());
+	canBeCarried = bayCategories.Contains(attributes->Category());
 
 	// Issue warnings if this ship has is misconfigured, e.g. is missing required values
 	// or has negative outfit, cargo, weapon, or engine capacity.
 	for(auto &&attr : set<string>{"outfit space", "cargo space", "weapon capacity", "engine capacity"})
 	{
-		double val = attributes.Get(attr);
+		double val = attributes->Get(attr);
 		if(val < 0)
 			warning += attr + ": " + Format::Number(val) + "\n";
 	}
-	if(attributes.Get("drag") <= 0.)
+	if(attributes->Get("drag") <= 0.)
 	{
-		warning += "Defaulting " + string(attributes.Get("drag") ? "invalid" : "missing") + " \"drag\" attribute to 100.0\n";
-		attributes.Set("drag", 100.);
+		warning += "Defaulting " + string(attributes->Get("drag") ? "invalid" : "missing") + " \"drag\" attribute to 100.0\n";
+		attributes.Mutable().Set("drag", 100.);
+		derivedStats.Calibrate(*attributes);
 	}
 
 	// Calculate the values used to determine this ship's value and danger.
@@ -892,7 +897,7 @@ void Ship::FinishLoading(bool isNewInstance)
 		string message = (!givenName.empty() ? "Ship \"" + givenName + "\" " : "") + "(" + VariantName() + "):\n";
 		ostringstream outfitNames;
 		outfitNames << "has outfits:\n";
-		for(const auto &it : outfits)
+		for(const auto &it : *outfits)
 			outfitNames << '\t' << it.second << " " + it.first->TrueName() << endl;
 		Logger::Log(message + warning + outfitNames.str(), Logger::Level::WARNING);
 	}
@@ -941,7 +946,7 @@ void Ship::FinishLoading(bool isNewInstance)
 // Check if this ship (model) and its outfits have been defined.
 bool Ship::IsValid() const
 {
-	for(auto &&outfit : outfits)
+	for(auto &&outfit : *outfits)
 		if(!outfit.first->IsDefined())
 			return false;
 
@@ -979,57 +984,57 @@ void Ship::Save(DataWriter &out) const
 		out.Write("attributes");
 		out.BeginChild();
 		{
-			out.Write("category", baseAttributes.Category());
-			out.Write("cost", baseAttributes.Cost());
-			out.Write("mass", baseAttributes.Mass());
-			for(const auto &it : baseAttributes.FlareSprites())
+			out.Write("category", baseAttributes->Category());
+			out.Write("cost", baseAttributes->Cost());
+			out.Write("mass", baseAttributes->Mass());
+			for(const auto &it : baseAttributes->FlareSprites())
 				for(int i = 0; i < it.second; ++i)
 					it.first.SaveSprite(out, "flare sprite");
-			for(const auto &it : baseAttributes.FlareSounds())
+			for(const auto &it : baseAttributes->FlareSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("flare sound", it.first->Name());
-			for(const auto &it : baseAttributes.ReverseFlareSprites())
+			for(const auto &it : baseAttributes->ReverseFlareSprites())
 				for(int i = 0; i < it.second; ++i)
 					it.first.SaveSprite(out, "reverse flare sprite");
-			for(const auto &it : baseAttributes.ReverseFlareSounds())
+			for(const auto &it : baseAttributes->ReverseFlareSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("reverse flare sound", it.first->Name());
-			for(const auto &it : baseAttributes.SteeringFlareSprites())
+			for(const auto &it : baseAttributes->SteeringFlareSprites())
 				for(int i = 0; i < it.second; ++i)
 					it.first.SaveSprite(out, "steering flare sprite");
-			for(const auto &it : baseAttributes.SteeringFlareSounds())
+			for(const auto &it : baseAttributes->SteeringFlareSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("steering flare sound", it.first->Name());
-			for(const auto &it : baseAttributes.AfterburnerEffects())
+			for(const auto &it : baseAttributes->AfterburnerEffects())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("afterburner effect", it.first->TrueName());
-			for(const auto &[effect, amount] : baseAttributes.JumpEffects())
+			for(const auto &[effect, amount] : baseAttributes->JumpEffects())
 				out.Write("jump effect", effect->TrueName(), amount);
-			for(const auto &it : baseAttributes.JumpSounds())
+			for(const auto &it : baseAttributes->JumpSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("jump sound", it.first->Name());
-			for(const auto &it : baseAttributes.JumpInSounds())
+			for(const auto &it : baseAttributes->JumpInSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("jump in sound", it.first->Name());
-			for(const auto &it : baseAttributes.JumpOutSounds())
+			for(const auto &it : baseAttributes->JumpOutSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("jump out sound", it.first->Name());
-			for(const auto &it : baseAttributes.HyperSounds())
+			for(const auto &it : baseAttributes->HyperSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("hyperdrive sound", it.first->Name());
-			for(const auto &it : baseAttributes.HyperInSounds())
+			for(const auto &it : baseAttributes->HyperInSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("hyperdrive in sound", it.first->Name());
-			for(const auto &it : baseAttributes.HyperOutSounds())
+			for(const auto &it : baseAttributes->HyperOutSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("hyperdrive out sound", it.first->Name());
-			for(const auto &it : baseAttributes.CargoScanSounds())
+			for(const auto &it : baseAttributes->CargoScanSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("cargo scan sound", it.first->Name());
-			for(const auto &it : baseAttributes.OutfitScanSounds())
+			for(const auto &it : baseAttributes->OutfitScanSounds())
 				for(int i = 0; i < it.second; ++i)
 					out.Write("outfit scan sound", it.first->Name());
-			for(const auto &it : baseAttributes.Attributes())
+			for(const auto &it : baseAttributes->Attributes())
 				if(it.second)
 					out.Write(it.first, it.second);
 		}
@@ -1039,7 +1044,7 @@ void Ship::Save(DataWriter &out) const
 		out.BeginChild();
 		{
 			using OutfitElement = pair<const Outfit *const, int>;
-			WriteSorted(outfits,
+			WriteSorted(*outfits,
 				[](const OutfitElement *lhs, const OutfitElement *rhs)
 					{ return lhs->first->TrueName() < rhs->first->TrueName(); },
 				[&out](const OutfitElement &it)
@@ -1059,7 +1064,7 @@ void Ship::Save(DataWriter &out) const
 		out.Write("hull", hull);
 		out.Write("position", position.X(), position.Y());
 
-		for(const EnginePoint &point : enginePoints)
+		for(const EnginePoint &point : *enginePoints)
 		{
 			out.Write("engine", 2. * point.X(), 2. * point.Y());
 			out.BeginChild();
@@ -1070,7 +1075,7 @@ void Ship::Save(DataWriter &out) const
 			out.EndChild();
 
 		}
-		for(const EnginePoint &point : reverseEnginePoints)
+		for(const EnginePoint &point : *reverseEnginePoints)
 		{
 			out.Write("reverse engine", 2. * point.X(), 2. * point.Y());
 			out.BeginChild();
@@ -1080,7 +1085,7 @@ void Ship::Save(DataWriter &out) const
 			out.Write(ENGINE_SIDE[point.side]);
 			out.EndChild();
 		}
-		for(const EnginePoint &point : steeringEnginePoints)
+		for(const EnginePoint &point : *steeringEnginePoints)
 		{
 			out.Write("steering engine", 2. * point.X(), 2. * point.Y());
 			out.BeginChild();
@@ -1145,18 +1150,18 @@ void Ship::Save(DataWriter &out) const
 				out.EndChild();
 			}
 		}
-		for(const Leak &leak : leaks)
+		for(const Leak &leak : *leaks)
 			out.Write("leak", leak.effect->TrueName(), leak.openPeriod, leak.closePeriod);
 
 		using EffectElement = pair<const Effect *const, int>;
 		auto effectSort = [](const EffectElement *lhs, const EffectElement *rhs)
 			{ return lhs->first->TrueName() < rhs->first->TrueName(); };
-		WriteSorted(explosionEffects, effectSort, [&out](const EffectElement &it)
+		WriteSorted(*explosionEffects, effectSort, [&out](const EffectElement &it)
 		{
 			if(it.second)
 				out.Write("explode", it.first->TrueName(), it.second);
 		});
-		WriteSorted(finalExplosions, effectSort, [&out](const EffectElement &it)
+		WriteSorted(*finalExplosions, effectSort, [&out](const EffectElement &it)
 		{
 			if(it.second)
 				out.Write("final explode", it.first->TrueName(), it.second);
@@ -1270,7 +1275,7 @@ const string &Ship::Noun() const
 // Get this ship's description.
 string Ship::Description() const
 {
-	return description.ToString();
+	return description->ToString();
 }
 
 
@@ -1286,7 +1291,7 @@ const Sprite *Ship::Thumbnail() const
 // Get this ship's cost.
 int64_t Ship::Cost() const
 {
-	return attributes.Cost();
+	return attributes->Cost();
 }
 
 
@@ -1294,7 +1299,7 @@ int64_t Ship::Cost() const
 // Get the cost of this ship's chassis, with no outfits installed.
 int64_t Ship::ChassisCost() const
 {
-	return baseAttributes.Cost();
+	return baseAttributes->Cost();
 }
 
 
@@ -1326,25 +1331,25 @@ vector<string> Ship::FlightCheck() const
 {
 	auto checks = vector<string>{};
 
-	double generation = attributes.Get("energy generation") - attributes.Get("energy consumption");
-	double consuming = attributes.Get("fuel energy");
-	double solar = attributes.Get("solar collection");
-	double battery = attributes.Get("energy capacity");
+	double generation = attributes->Get("energy generation") - attributes->Get("energy consumption");
+	double consuming = attributes->Get("fuel energy");
+	double solar = attributes->Get("solar collection");
+	double battery = attributes->Get("energy capacity");
 	double energy = generation + consuming + solar + battery;
-	double fuelChange = attributes.Get("fuel generation") - attributes.Get("fuel consumption");
-	double fuelCapacity = attributes.Get("fuel capacity");
+	double fuelChange = attributes->Get("fuel generation") - attributes->Get("fuel consumption");
+	double fuelCapacity = attributes->Get("fuel capacity");
 	double fuel = fuelCapacity + fuelChange;
-	double thrust = attributes.Get("thrust");
-	double reverseThrust = attributes.Get("reverse thrust");
-	double afterburner = attributes.Get("afterburner thrust");
-	double thrustEnergy = attributes.Get("thrusting energy");
-	double thrustHeat = attributes.Get("thrusting heat");
-	double turn = attributes.Get("turn");
-	double turnEnergy = attributes.Get("turning energy");
-	double turnHeat = attributes.Get("turning heat");
+	double thrust = attributes->Get("thrust");
+	double reverseThrust = attributes->Get("reverse thrust");
+	double afterburner = attributes->Get("afterburner thrust");
+	double thrustEnergy = attributes->Get("thrusting energy");
+	double thrustHeat = attributes->Get("thrusting heat");
+	double turn = attributes->Get("turn");
+	double turnEnergy = attributes->Get("turning energy");
+	double turnHeat = attributes->Get("turning heat");
 	double hyperDrive = navigation.HasHyperdrive();
 	double jumpDrive = navigation.HasJumpDrive();
-	int bunks = attributes.Get("bunks");
+	int bunks = attributes->Get("bunks");
 
 	// Report the first error condition that will prevent takeoff:
 	if(!bunks && RequiredCrew())
@@ -1388,7 +1393,7 @@ vector<string> Ship::FlightCheck() const
 			if(fuelCapacity < navigation.JumpFuel())
 				checks.emplace_back("no fuel?");
 		}
-		for(const auto &it : outfits)
+		for(const auto &it : *outfits)
 		{
 			const Weapon *weapon = it.first->GetWeapon().get();
 			if(weapon && weapon->FiringEnergy() > energy)
@@ -1754,12 +1759,12 @@ void Ship::Launch(list<shared_ptr<Ship>> &ships, vector<Visual> &visuals)
 	// eject any ships still docked, possibly destroying them in the process.
 	bool ejecting = IsDestroyed();
 	if(!ejecting && (!commands.Has(Command::DEPLOY) || zoom != 1.f || hyperspaceCount ||
-			(cloak && !attributes.Get("cloaked deployment"))))
+			(cloak && !attributes->Get("cloaked deployment"))))
 		return;
 
 	for(Bay &bay : bays)
 		if(bay.ship
-			&& ((bay.ship->Commands().Has(Command::DEPLOY) && !Random::Int(40 + 20 * !bay.ship->attributes.Get("automaton")))
+			&& ((bay.ship->Commands().Has(Command::DEPLOY) && !Random::Int(40 + 20 * !bay.ship->attributes->Get("automaton")))
 			|| (ejecting && !Random::Int(6))))
 		{
 			// Resupply any ships launching of their own accord.
@@ -1785,7 +1790,7 @@ void Ship::Launch(list<shared_ptr<Ship>> &ships, vector<Visual> &visuals)
 
 				// This ship will refuel naturally based on the carrier's fuel
 				// collection, but the carrier may have some reserves to spare.
-				double maxFuel = bay.ship->attributes.Get("fuel capacity");
+				double maxFuel = bay.ship->attributes->Get("fuel capacity");
 				if(maxFuel)
 				{
 					double spareFuel = fuel - navigation.JumpFuel();
@@ -1865,7 +1870,7 @@ shared_ptr<Ship> Ship::Board(bool autoPlunder, bool nonDocking)
 		if(victim->Attributes().Get("energy capacity") > 0 && victim->energy < 200.)
 		{
 			helped = true;
-			double toGive = max(attributes.Get("energy capacity") * 0.1, victim->Attributes().Get("energy capacity") * 0.2);
+			double toGive = max(attributes->Get("energy capacity") * 0.1, victim->Attributes().Get("energy capacity") * 0.2);
 			TransferEnergy(max(200., toGive), victim.get());
 		}
 		if(helped)
@@ -1912,18 +1917,18 @@ int Ship::Scan(const PlayerInfo &player)
 
 	// The range of a scanner is proportional to the square root of its power.
 	// Because of Pythagoras, if we use square-distance, we can skip this square root.
-	double cargoDistanceSquared = attributes.Get("cargo scan power");
-	double outfitDistanceSquared = attributes.Get("outfit scan power");
+	double cargoDistanceSquared = attributes->Get("cargo scan power");
+	double outfitDistanceSquared = attributes->Get("outfit scan power");
 
 	// Bail out if this ship has no scanners.
 	if(!cargoDistanceSquared && !outfitDistanceSquared)
 		return 0;
 
-	double cargoSpeed = attributes.Get("cargo scan efficiency");
+	double cargoSpeed = attributes->Get("cargo scan efficiency");
 	if(!cargoSpeed)
 		cargoSpeed = cargoDistanceSquared;
 
-	double outfitSpeed = attributes.Get("outfit scan efficiency");
+	double outfitSpeed = attributes->Get("outfit scan efficiency");
 	if(!outfitSpeed)
 		outfitSpeed = outfitDistanceSquared;
 
@@ -1939,8 +1944,9 @@ int Ship::Scan(const PlayerInfo &player)
 	// of 0.
 	// If instantly scanning very small ships is desirable, this can be removed.
 	// One point of scan opacity is the equivalent of an additional ton of cargo / outfit space
-	const double outfitsSize = target->baseAttributes.Get("outfit space") + target->attributes.Get("outfit scan opacity");
-	const double cargoSize = target->attributes.Get("cargo space") + target->attributes.Get("cargo scan opacity");
+	const double outfitsSize = target->baseAttributes->Get("outfit space")
+		+ target->attributes->Get("outfit scan opacity");
+	const double cargoSize = target->attributes->Get("cargo space") + target->attributes->Get("cargo scan opacity");
 	double outfits = max(SCAN_MIN_OUTFIT_SPACE, outfitsSize) * SCAN_OUTFIT_FACTOR;
 	double cargo = max(SCAN_MIN_CARGO_SPACE, cargoSize) * SCAN_CARGO_FACTOR;
 
@@ -2000,16 +2006,16 @@ int Ship::Scan(const PlayerInfo &player)
 			for(const auto &sound : sounds)
 				Audio::Play(sound.first, position, SoundCategory::SCAN);
 	};
-	if(attributes.Get("silent scans"))
+	if(attributes->Get("silent scans"))
 	{
 		// No sounds.
 	}
 	else if(isYours || (target->isYours))
 	{
 		if(activeScanning & ShipEvent::SCAN_CARGO)
-			playScanSounds(attributes.CargoScanSounds(), position);
+			playScanSounds(attributes->CargoScanSounds(), position);
 		if(activeScanning & ShipEvent::SCAN_OUTFITS)
-			playScanSounds(attributes.OutfitScanSounds(), position);
+			playScanSounds(attributes->OutfitScanSounds(), position);
 	}
 
 	bool isImportant = false;
@@ -2123,7 +2129,7 @@ void Ship::Fire(vector<Projectile> &projectiles, vector<Visual> &visuals, vector
 				armament.Fire(i, *this, projectiles, visuals, Random::Real() < jamChance);
 				if(cloak)
 				{
-					double cloakingFiring = attributes.Get("cloaked firing");
+					double cloakingFiring = attributes->Get("cloaked firing");
 					// Any negative value means shooting does not decloak.
 					if(cloakingFiring > 0)
 						cloak -= cloakingFiring;
@@ -2286,10 +2292,10 @@ bool Ship::IsIonized() const
 		return false;
 
 	// A ship can only be fully ionized if its engines or weapons require energy.
-	bool usesEnergy = attributes.Get("thrusting energy") > 0
-		|| attributes.Get("reverse thrusting energy") > 0
-		|| attributes.Get("turning energy") > 0
-		|| any_of(outfits.begin(), outfits.end(), [](const auto &it) -> bool {
+	bool usesEnergy = attributes->Get("thrusting energy") > 0
+		|| attributes->Get("reverse thrusting energy") > 0
+		|| attributes->Get("turning energy") > 0
+		|| any_of(outfits->begin(), outfits->end(), [](const auto &it) -> bool {
 			const Weapon *weapon = it.first->GetWeapon().get();
 			return weapon && weapon->FiringEnergy() > 0;
 		});
@@ -2363,22 +2369,22 @@ bool Ship::CannotAct(ActionType actionType) const
 		switch(actionType)
 		{
 			case ActionType::AFTERBURNER:
-				canActCloaked = attributes.Get("cloaked afterburner");
+				canActCloaked = attributes->Get("cloaked afterburner");
 				break;
 			case ActionType::BOARD:
-				canActCloaked = attributes.Get("cloaked boarding");
+				canActCloaked = attributes->Get("cloaked boarding");
 				break;
 			case ActionType::COMMUNICATION:
-				canActCloaked = attributes.Get("cloaked communication");
+				canActCloaked = attributes->Get("cloaked communication");
 				break;
 			case ActionType::FIRE:
-				canActCloaked = attributes.Get("cloaked firing");
+				canActCloaked = attributes->Get("cloaked firing");
 				break;
 			case ActionType::PICKUP:
-				canActCloaked = attributes.Get("cloaked pickup");
+				canActCloaked = attributes->Get("cloaked pickup");
 				break;
 			case ActionType::SCAN:
-				canActCloaked = attributes.Get("cloaked scanning");
+				canActCloaked = attributes->Get("cloaked scanning");
 				break;
 		}
 	return (cloak == 1. && !canActCloaked) || (cloak != 1. && cloak && !cloakDisruption && !canActCloaked);
@@ -2472,7 +2478,7 @@ bool Ship::IsReadyToJump(bool waitingIsReady) const
 
 	Point direction = targetSystem->Position() - currentSystem->Position();
 	bool isJump = (jumpUsed.first == JumpType::JUMP_DRIVE);
-	double scramThreshold = attributes.Get("scram drive");
+	double scramThreshold = attributes->Get("scram drive");
 
 	// If the system has a departure distance the ship is only allowed to leave the system
 	// if it is beyond this distance.
@@ -2491,7 +2497,7 @@ bool Ship::IsReadyToJump(bool waitingIsReady) const
 		if(deviation > scramThreshold)
 			return false;
 	}
-	else if(velocity.Length() > attributes.Get("jump speed"))
+	else if(velocity.Length() > attributes->Get("jump speed"))
 		return false;
 
 	if(!isJump)
@@ -2557,21 +2563,21 @@ double Ship::SteeringDirection() const
 // Get the points from which engine flares should be drawn.
 const vector<Ship::EnginePoint> &Ship::EnginePoints() const
 {
-	return enginePoints;
+	return *enginePoints;
 }
 
 
 
 const vector<Ship::EnginePoint> &Ship::ReverseEnginePoints() const
 {
-	return reverseEnginePoints;
+	return *reverseEnginePoints;
 }
 
 
 
 const vector<Ship::EnginePoint> &Ship::SteeringEnginePoints() const
 {
-	return steeringEnginePoints;
+	return *steeringEnginePoints;
 }
 
 
@@ -2638,18 +2644,18 @@ void Ship::Recharge(int rechargeType, bool hireCrew)
 		return;
 
 	if(hireCrew)
-		crew = min<int>(max(crew, RequiredCrew()), attributes.Get("bunks"));
+		crew = min<int>(max(crew, RequiredCrew()), attributes->Get("bunks"));
 	pilotError = 0;
 	pilotOkay = 0;
 
-	if((rechargeType & Port::RechargeType::Shields) || attributes.Get("shield generation"))
+	if((rechargeType & Port::RechargeType::Shields) || attributes->Get("shield generation"))
 		shields = MaxShields();
-	if((rechargeType & Port::RechargeType::Hull) || attributes.Get("hull repair rate"))
+	if((rechargeType & Port::RechargeType::Hull) || attributes->Get("hull repair rate"))
 		hull = MaxHull();
-	if((rechargeType & Port::RechargeType::Energy) || attributes.Get("energy generation"))
-		energy = attributes.Get("energy capacity");
-	if((rechargeType & Port::RechargeType::Fuel) || attributes.Get("fuel generation"))
-		fuel = attributes.Get("fuel capacity");
+	if((rechargeType & Port::RechargeType::Energy) || attributes->Get("energy generation"))
+		energy = attributes->Get("energy capacity");
+	if((rechargeType & Port::RechargeType::Fuel) || attributes->Get("fuel generation"))
+		fuel = attributes->Get("fuel capacity");
 
 	heat = IdleHeat();
 	ionization = 0.;
@@ -2676,7 +2682,8 @@ bool Ship::CanRefuel(const Ship &other) const
 
 bool Ship::CanGiveEnergy(const Ship &other) const
 {
-	double toGive = min(other.attributes.Get("energy capacity"), max(200., other.attributes.Get("energy capacity") * 0.2));
+	double toGive = min(other.attributes->Get("energy capacity"),
+		max(200., other.attributes->Get("energy capacity") * 0.2));
 	return energy >= 2 * toGive;
 }
 
@@ -2684,10 +2691,10 @@ bool Ship::CanGiveEnergy(const Ship &other) const
 
 double Ship::TransferFuel(double amount, Ship *to)
 {
-	amount = max(fuel - attributes.Get("fuel capacity"), amount);
+	amount = max(fuel - attributes->Get("fuel capacity"), amount);
 	if(to)
 	{
-		amount = min(to->attributes.Get("fuel capacity") - to->fuel, amount);
+		amount = min(to->attributes->Get("fuel capacity") - to->fuel, amount);
 		to->fuel += amount;
 	}
 	fuel -= amount;
@@ -2698,10 +2705,10 @@ double Ship::TransferFuel(double amount, Ship *to)
 
 double Ship::TransferEnergy(double amount, Ship *to)
 {
-	amount = max(energy - attributes.Get("energy capacity"), amount);
+	amount = max(energy - attributes->Get("energy capacity"), amount);
 	if(to)
 	{
-		amount = min(to->attributes.Get("energy capacity") - to->energy, amount);
+		amount = min(to->attributes->Get("energy capacity") - to->energy, amount);
 		to->energy += amount;
 	}
 	energy -= amount;
@@ -2800,7 +2807,7 @@ double Ship::Hull() const
 
 double Ship::Fuel() const
 {
-	double maximum = attributes.Get("fuel capacity");
+	double maximum = attributes->Get("fuel capacity");
 	return maximum ? min(1., fuel / maximum) : 0.;
 }
 
@@ -2808,7 +2815,7 @@ double Ship::Fuel() const
 
 double Ship::Energy() const
 {
-	double maximum = attributes.Get("energy capacity");
+	double maximum = attributes->Get("energy capacity");
 	return maximum ? min(1., energy / maximum) : (hull > 0.) ? 1. : 0.;
 }
 
@@ -2855,13 +2862,13 @@ double Ship::DisabledHull() const
 // Get the maximum shield and hull values of the ship, accounting for multipliers.
 double Ship::MaxShields() const
 {
-	return attributes.Get("shields") * (1 + attributes.Get("shield multiplier"));
+	return derivedStats.MaxShields();
 }
 
 
 double Ship::MaxHull() const
 {
-	return attributes.Get("hull") * (1 + attributes.Get("hull multiplier"));
+	return derivedStats.MaxHull();
 }
 
 
@@ -2959,15 +2966,15 @@ bool Ship::NeedsFuel(bool followParent) const
 	}
 	if(!jumpFuel)
 		jumpFuel = navigation.JumpFuel(targetSystem);
-	return (fuel < jumpFuel) && (attributes.Get("fuel capacity") >= jumpFuel);
+	return (fuel < jumpFuel) && (attributes->Get("fuel capacity") >= jumpFuel);
 }
 
 
 
 bool Ship::NeedsEnergy() const
 {
-	return attributes.Get("energy capacity") && !energy && !attributes.Get("energy generation")
-			&& !attributes.Get("fuel energy") && !attributes.Get("solar collection");
+	return attributes->Get("energy capacity") && !energy && !attributes->Get("energy generation")
+			&& !attributes->Get("fuel energy") && !attributes->Get("solar collection");
 }
 
 
@@ -2977,7 +2984,7 @@ double Ship::JumpFuelMissing() const
 	// Used for smart refueling: transfer only as much as really needed
 	// includes checking if fuel cap is high enough at all
 	double jumpFuel = navigation.JumpFuel(targetSystem);
-	if(!jumpFuel || fuel > jumpFuel || jumpFuel > attributes.Get("fuel capacity"))
+	if(!jumpFuel || fuel > jumpFuel || jumpFuel > attributes->Get("fuel capacity"))
 		return 0.;
 
 	return jumpFuel - fuel;
@@ -2990,14 +2997,14 @@ double Ship::IdleHeat() const
 {
 	// This ship's cooling ability:
 	double coolingEfficiency = CoolingEfficiency();
-	double cooling = coolingEfficiency * attributes.Get("cooling");
-	double activeCooling = coolingEfficiency * attributes.Get("active cooling");
+	double cooling = coolingEfficiency * attributes->Get(Attribute::COOLING);
+	double activeCooling = coolingEfficiency * attributes->Get(Attribute::ACTIVE_COOLING);
 
 	// Idle heat is the heat level where:
 	// heat = heat - heat * diss + heatGen - cool - activeCool * heat / maxHeat
 	// heat = heat - heat * (diss + activeCool / maxHeat) + (heatGen - cool)
 	// heat * (diss + activeCool / maxHeat) = (heatGen - cool)
-	double production = max(0., attributes.Get("heat generation") - cooling);
+	double production = max(0., attributes->Get(Attribute::HEAT_GENERATION) - cooling);
 	double dissipation = HeatDissipation() + activeCooling / MaximumHeat();
 	if(!dissipation) return production ? numeric_limits<double>::max() : 0;
 	return production / dissipation;
@@ -3008,7 +3015,7 @@ double Ship::IdleHeat() const
 // Get the heat dissipation, in heat units per heat unit per frame.
 double Ship::HeatDissipation() const
 {
-	return .001 * attributes.Get("heat dissipation");
+	return derivedStats.HeatDissipation();
 }
 
 
@@ -3016,7 +3023,7 @@ double Ship::HeatDissipation() const
 // Get the maximum heat level, in heat units (not temperature).
 double Ship::MaximumHeat() const
 {
-	return MAXIMUM_TEMPERATURE * (cargo.Used() + attributes.Mass() + attributes.Get("heat capacity"));
+	return MAXIMUM_TEMPERATURE * (cargo.Used() + attributes->Mass() + derivedStats.HeatCapacity());
 }
 
 
@@ -3030,7 +3037,7 @@ bool Ship::IsCloaked() const
 
 double Ship::CloakingSpeed() const
 {
-	return attributes.Get("cloak") + attributes.Get("cloak by mass") * 1000. / Mass();
+	return derivedStats.Cloak() + derivedStats.CloakByMass() * 1000. / Mass();
 }
 
 
@@ -3038,18 +3045,18 @@ double Ship::CloakingSpeed() const
 bool Ship::Phases(Projectile &projectile) const
 {
 	// No Phasing if we are not cloaked, or not having cloak phasing.
-	if(!IsCloaked() || attributes.Get("cloak phasing") == 0)
+	if(!IsCloaked() || attributes->Get(Attribute::CLOAK_PHASING) == 0)
 		return false;
 
 	// Check for full phasing first, to avoid more expensive lookups.
-	if(attributes.Get("cloak phasing") >= 1 || projectile.Phases(*this))
+	if(attributes->Get(Attribute::CLOAK_PHASING) >= 1 || projectile.Phases(*this))
 		return true;
 
 	// Perform the most expensive checks last.
 	// If multiple ships with partial phasing are stacked on top of each other, then the chance of collision increases
 	// significantly, because each ship in the firing-line resets the SetPhase of the previous one. But such stacks
 	// are rare, so we are not going to do anything special for this.
-	if(attributes.Get("cloak phasing") >= Random::Real())
+	if(attributes->Get(Attribute::CLOAK_PHASING) >= Random::Real())
 	{
 		projectile.SetPhases(this);
 		return true;
@@ -3063,11 +3070,7 @@ bool Ship::Phases(Projectile &projectile) const
 // Calculate the multiplier for cooling efficiency.
 double Ship::CoolingEfficiency() const
 {
-	// This is an S-curve where the efficiency is 100% if you have no outfits
-	// that create "cooling inefficiency", and as that value increases the
-	// efficiency stays high for a while, then drops off, then approaches 0.
-	double x = attributes.Get("cooling inefficiency");
-	return 2. + 2. / (1. + exp(x / -2.)) - 4. / (1. + exp(x / -4.));
+	return derivedStats.CoolingEfficiency();
 }
 
 
@@ -3082,7 +3085,7 @@ int Ship::Crew() const
 // Calculate the drag on this ship. The drag can be no greater than the mass.
 double Ship::Drag() const
 {
-	double drag = attributes.Get("drag") / (1. + attributes.Get("drag reduction"));
+	double drag = derivedStats.Drag();
 	double mass = InertialMass();
 	return drag >= mass ? mass : drag;
 }
@@ -3093,7 +3096,7 @@ double Ship::Drag() const
 // divided by the mass, up to a value of 1.
 double Ship::DragForce() const
 {
-	double drag = attributes.Get("drag") / (1. + attributes.Get("drag reduction"));
+	double drag = derivedStats.Drag();
 	double mass = InertialMass();
 	return drag >= mass ? 1. : drag / mass;
 }
@@ -3102,19 +3105,15 @@ double Ship::DragForce() const
 
 int Ship::RequiredCrew() const
 {
-	if(attributes.Get("automaton"))
-		return 0;
-
-	// Drones do not need crew, but all other ships need at least one.
-	return max<int>(1, attributes.Get("required crew"));
+	return derivedStats.RequiredCrew();
 }
 
 
 
 int Ship::CrewValue() const
 {
-	int crewEquivalent = attributes.Get("crew equivalent");
-	if(attributes.Get("use crew equivalent as crew"))
+	int crewEquivalent = attributes->Get(Attribute::CREW_EQUIVALENT);
+	if(attributes->Get(Attribute::USE_CREW_EQUIVALENT_AS_CREW))
 		return crewEquivalent;
 	return max(Crew(), RequiredCrew()) + crewEquivalent;
 }
@@ -3123,7 +3122,7 @@ int Ship::CrewValue() const
 
 void Ship::AddCrew(int count)
 {
-	crew = min<int>(crew + count, attributes.Get("bunks"));
+	crew = min<int>(crew + count, attributes->Get("bunks"));
 }
 
 
@@ -3138,7 +3137,7 @@ bool Ship::CanBeFlagship() const
 
 double Ship::Mass() const
 {
-	return carriedMass + cargo.Used() + attributes.Mass();
+	return carriedMass + cargo.Used() + attributes->Mass();
 }
 
 
@@ -3146,15 +3145,15 @@ double Ship::Mass() const
 // Account for inertia reduction, which affects movement but has no effect on the ship's heat capacity.
 double Ship::InertialMass() const
 {
-	return Mass() / (1. + attributes.Get("inertia reduction"));
+	return Mass() / derivedStats.InertiaDivisor();
 }
 
 
 
 double Ship::TurnRate() const
 {
-	return attributes.Get("turn") / InertialMass()
-		* (1. + attributes.Get("turn multiplier"));
+	return derivedStats.Turn() / InertialMass()
+		* derivedStats.TurnMultiplier();
 }
 
 
@@ -3176,9 +3175,9 @@ double Ship::CrewTurnRate() const
 
 double Ship::Acceleration() const
 {
-	double thrust = attributes.Get("thrust");
-	return (thrust ? thrust : attributes.Get("afterburner thrust")) / InertialMass()
-		* (1. + attributes.Get("acceleration multiplier"));
+	double thrust = derivedStats.Thrust();
+	return (thrust ? thrust : derivedStats.AfterburnerThrust()) / InertialMass()
+		* derivedStats.AccelerationMultiplier();
 }
 
 
@@ -3203,8 +3202,8 @@ double Ship::MaxVelocity(bool withAfterburner) const
 	// v * drag / mass == thrust / mass
 	// v * drag == thrust
 	// v = thrust / drag
-	double thrust = attributes.Get("thrust");
-	double afterburnerThrust = attributes.Get("afterburner thrust");
+	double thrust = derivedStats.Thrust();
+	double afterburnerThrust = derivedStats.AfterburnerThrust();
 	return (thrust ? thrust + afterburnerThrust * withAfterburner : afterburnerThrust) / Drag();
 }
 
@@ -3212,15 +3211,15 @@ double Ship::MaxVelocity(bool withAfterburner) const
 
 double Ship::ReverseAcceleration() const
 {
-	return attributes.Get("reverse thrust") / InertialMass()
-		* (1. + attributes.Get("acceleration multiplier"));
+	return derivedStats.ReverseThrust() / InertialMass()
+		* derivedStats.AccelerationMultiplier();
 }
 
 
 
 double Ship::MaxReverseVelocity() const
 {
-	return attributes.Get("reverse thrust") / Drag();
+	return derivedStats.ReverseThrust() / Drag();
 }
 
 
@@ -3261,13 +3260,13 @@ int Ship::TakeDamage(vector<Visual> &visuals, const DamageDealt &damage, const G
 	shields -= damage.Shield();
 	if(damage.Shield() && !isDisabled)
 	{
-		int disabledDelay = attributes.Get("depleted shield delay");
+		int disabledDelay = attributes->Get("depleted shield delay");
 		shieldDelay = max<int>(shieldDelay, (shields <= 0. && disabledDelay)
-			? disabledDelay : attributes.Get("shield delay"));
+			? disabledDelay : attributes->Get("shield delay"));
 	}
 	hull -= damage.Hull();
 	if(damage.Hull() && !isDisabled)
-		hullDelay = max(hullDelay, static_cast<int>(attributes.Get("repair delay")));
+		hullDelay = max(hullDelay, static_cast<int>(attributes->Get("repair delay")));
 
 	energy -= damage.Energy();
 	heat += damage.Heat();
@@ -3304,7 +3303,7 @@ int Ship::TakeDamage(vector<Visual> &visuals, const DamageDealt &damage, const G
 	if(!wasDisabled && isDisabled)
 	{
 		type |= ShipEvent::DISABLE;
-		hullDelay = max(hullDelay, static_cast<int>(attributes.Get("disabled repair delay")));
+		hullDelay = max(hullDelay, static_cast<int>(attributes->Get("disabled repair delay")));
 	}
 	if(!wasDestroyed && IsDestroyed())
 	{
@@ -3407,7 +3406,7 @@ bool Ship::CanCarry(const Ship &ship) const
 	if(!HasBays() || !ship.CanBeCarried() || (IsYours() && !ship.IsYours()))
 		return false;
 	// Check only for the category that we are interested in.
-	const string &category = ship.attributes.Category();
+	const string &category = ship.attributes->Category();
 
 	int free = BaysTotal(category);
 	if(!free)
@@ -3420,7 +3419,7 @@ bool Ship::CanCarry(const Ship &ship) const
 			continue;
 		if(escort.get() == &ship)
 			break;
-		if(escort->attributes.Category() == category && !escort->IsDestroyed() &&
+		if(escort->attributes->Category() == category && !escort->IsDestroyed() &&
 				(!IsYours() || (IsYours() && escort->IsYours())))
 			--free;
 		if(!free)
@@ -3444,7 +3443,7 @@ bool Ship::Carry(const shared_ptr<Ship> &ship)
 		return false;
 
 	// Check only for the category that we are interested in.
-	const string &category = ship->attributes.Category();
+	const string &category = ship->attributes->Category();
 
 	// NPC ships should always transfer cargo. Player ships should only
 	// transfer cargo if they set the AI preference.
@@ -3605,14 +3604,14 @@ void Ship::Jettison(const Outfit *outfit, int count, bool wasAppeasing)
 
 const Outfit &Ship::Attributes() const
 {
-	return attributes;
+	return *attributes;
 }
 
 
 
 const Outfit &Ship::BaseAttributes() const
 {
-	return baseAttributes;
+	return *baseAttributes;
 }
 
 
@@ -3620,15 +3619,15 @@ const Outfit &Ship::BaseAttributes() const
 // Get outfit information.
 const map<const Outfit *, int> &Ship::Outfits() const
 {
-	return outfits;
+	return *outfits;
 }
 
 
 
 int Ship::OutfitCount(const Outfit *outfit) const
 {
-	auto it = outfits.find(outfit);
-	return (it == outfits.end()) ? 0 : it->second;
+	auto it = outfits->find(outfit);
+	return (it == outfits->end()) ? 0 : it->second;
 }
 
 
@@ -3638,18 +3637,20 @@ void Ship::AddOutfit(const Outfit *outfit, int count)
 {
 	if(outfit && count)
 	{
-		auto it = outfits.find(outfit);
-		int before = outfits.count(outfit);
-		if(it == outfits.end())
-			outfits[outfit] = count;
+		map<const Outfit *, int> &installed = outfits.Mutable();
+		auto it = installed.find(outfit);
+		int before = installed.count(outfit);
+		if(it == installed.end())
+			installed[outfit] = count;
 		else
 		{
 			it->second += count;
 			if(!it->second)
-				outfits.erase(it);
+				installed.erase(it);
 		}
-		int after = outfits.count(outfit);
-		attributes.Add(*outfit, count);
+		int after = installed.count(outfit);
+		attributes.Mutable().Add(*outfit, count);
+		derivedStats.Calibrate(*attributes);
 		if(outfit->GetWeapon())
 		{
 			armament.Add(outfit, count);
@@ -3660,7 +3661,7 @@ void Ship::AddOutfit(const Outfit *outfit, int count)
 
 		if(outfit->Get("cargo space"))
 		{
-			cargo.SetSize(attributes.Get("cargo space"));
+			cargo.SetSize(attributes->Get("cargo space"));
 			// Only the player's ships make use of attraction and deterrence.
 			if(isYours)
 				attraction = CalculateAttraction();
@@ -3704,16 +3705,16 @@ Ship::CanFireResult Ship::CanFire(const Weapon *weapon) const
 {
 	if(weapon->Ammo())
 	{
-		auto it = outfits.find(weapon->Ammo());
-		if(it == outfits.end() || it->second < weapon->AmmoUsage())
+		auto it = outfits->find(weapon->Ammo());
+		if(it == outfits->end() || it->second < weapon->AmmoUsage())
 			return CanFireResult::NO_AMMO;
 	}
 
 	if(weapon->ConsumesEnergy()
-			&& energy < weapon->FiringEnergy() + weapon->RelativeFiringEnergy() * attributes.Get("energy capacity"))
+			&& energy < weapon->FiringEnergy() + weapon->RelativeFiringEnergy() * attributes->Get("energy capacity"))
 		return CanFireResult::NO_ENERGY;
 	if(weapon->ConsumesFuel()
-			&& fuel < weapon->FiringFuel() + weapon->RelativeFiringFuel() * attributes.Get("fuel capacity"))
+			&& fuel < weapon->FiringFuel() + weapon->RelativeFiringFuel() * attributes->Get("fuel capacity"))
 		return CanFireResult::NO_FUEL;
 	// We do check hull, but we don't check shields. Ships can survive with all shields depleted.
 	// Ships should not disable themselves, so we check if we stay above minimumHull.
@@ -3745,8 +3746,8 @@ void Ship::ExpendAmmo(const Weapon &weapon)
 {
 	// Compute this ship's initial capacities, in case the consumption of the ammunition outfit(s)
 	// modifies them, so that relative costs are calculated based on the pre-firing state of the ship.
-	const double relativeEnergyChange = weapon.RelativeFiringEnergy() * attributes.Get("energy capacity");
-	const double relativeFuelChange = weapon.RelativeFiringFuel() * attributes.Get("fuel capacity");
+	const double relativeEnergyChange = weapon.RelativeFiringEnergy() * attributes->Get("energy capacity");
+	const double relativeFuelChange = weapon.RelativeFiringFuel() * attributes->Get("fuel capacity");
 	const double relativeHeatChange = !weapon.RelativeFiringHeat() ? 0. : weapon.RelativeFiringHeat() * MaximumHeat();
 	const double relativeHullChange = weapon.RelativeFiringHull() * MaxHull();
 	const double relativeShieldChange = weapon.RelativeFiringShields() * MaxShields();
@@ -3960,7 +3961,7 @@ void Ship::Linger()
 
 bool Ship::Imitates(const Ship &other) const
 {
-	return displayModelName == other.DisplayModelName() && outfits == other.Outfits();
+	return displayModelName == other.DisplayModelName() && *outfits == other.Outfits();
 }
 
 
@@ -4008,10 +4009,10 @@ int Ship::StepDestroyed(vector<Visual> &visuals, list<shared_ptr<Flotsam>> &flot
 			double size = Width() + Height();
 			double scale = .03 * size + .5;
 			double radius = .2 * size;
-			int debrisCount = attributes.Mass() * .07;
+			int debrisCount = attributes->Mass() * .07;
 
 			// Estimate how many new visuals will be added during destruction.
-			visuals.reserve(visuals.size() + debrisCount + explosionTotal + finalExplosions.size());
+			visuals.reserve(visuals.size() + debrisCount + explosionTotal + finalExplosions->size());
 
 			for(int i = 0; i < debrisCount; ++i)
 			{
@@ -4024,7 +4025,7 @@ int Ship::StepDestroyed(vector<Visual> &visuals, list<shared_ptr<Flotsam>> &flot
 
 			for(unsigned i = 0; i < explosionTotal / 2; ++i)
 				CreateExplosion(visuals, true);
-			for(const auto &it : finalExplosions)
+			for(const auto &it : *finalExplosions)
 				visuals.emplace_back(*it.first, position, velocity, angle);
 			// For everything in this ship's cargo hold there is a 25% chance
 			// that it will survive as flotsam.
@@ -4033,7 +4034,7 @@ int Ship::StepDestroyed(vector<Visual> &visuals, list<shared_ptr<Flotsam>> &flot
 			for(const auto &it : cargo.Outfits())
 				Jettison(it.first, Random::Binomial(it.second, .25));
 			// Ammunition has a default 5% chance to survive as flotsam.
-			for(const auto &it : outfits)
+			for(const auto &it : *outfits)
 			{
 				double flotsamChance = it.first->Get("flotsam chance");
 				if(flotsamChance > 0.)
@@ -4077,7 +4078,7 @@ int Ship::StepDestroyed(vector<Visual> &visuals, list<shared_ptr<Flotsam>> &flot
 		CreateExplosion(visuals);
 
 	// Handle hull "leaks."
-	for(const Leak &leak : leaks)
+	for(const Leak &leak : *leaks)
 		if(GetMask().IsLoaded() && leak.openPeriod > 0 && !Random::Int(leak.openPeriod))
 		{
 			activeLeaks.push_back(leak);
@@ -4126,36 +4127,36 @@ void Ship::DoGeneration()
 		// 4. Shields of carried fighters
 		// 5. Transfer of excess energy and fuel to carried fighters.
 
-		const double hullAvailable = (attributes.Get("hull repair rate")
-			+ (hullDelay ? 0 : attributes.Get("delayed hull repair rate")))
-			* (1. + attributes.Get("hull repair multiplier"))
-			* (1. + attributes.Get("cloaked repair multiplier") * Cloaking());
-		const double hullEnergy = (attributes.Get("hull energy")
-			+ (hullDelay ? 0 : attributes.Get("delayed hull energy")))
-			* (1. + attributes.Get("hull energy multiplier")) / hullAvailable;
-		const double hullFuel = (attributes.Get("hull fuel")
-			+ (hullDelay ? 0 : attributes.Get("delayed hull fuel")))
-			* (1. + attributes.Get("hull fuel multiplier")) / hullAvailable;
-		const double hullHeat = (attributes.Get("hull heat")
-			+ (hullDelay ? 0 : attributes.Get("delayed hull heat")))
-			* (1. + attributes.Get("hull heat multiplier")) / hullAvailable;
+		const double hullAvailable = (attributes->Get(Attribute::HULL_REPAIR_RATE)
+			+ (hullDelay ? 0 : attributes->Get(Attribute::DELAYED_HULL_REPAIR_RATE)))
+			* (1. + attributes->Get(Attribute::HULL_REPAIR_MULTIPLIER))
+			* (1. + attributes->Get(Attribute::CLOAKED_REPAIR_MULTIPLIER) * Cloaking());
+		const double hullEnergy = (attributes->Get(Attribute::HULL_ENERGY)
+			+ (hullDelay ? 0 : attributes->Get(Attribute::DELAYED_HULL_ENERGY)))
+			* (1. + attributes->Get(Attribute::HULL_ENERGY_MULTIPLIER)) / hullAvailable;
+		const double hullFuel = (attributes->Get(Attribute::HULL_FUEL)
+			+ (hullDelay ? 0 : attributes->Get(Attribute::DELAYED_HULL_FUEL)))
+			* (1. + attributes->Get(Attribute::HULL_FUEL_MULTIPLIER)) / hullAvailable;
+		const double hullHeat = (attributes->Get(Attribute::HULL_HEAT)
+			+ (hullDelay ? 0 : attributes->Get(Attribute::DELAYED_HULL_HEAT)))
+			* (1. + attributes->Get(Attribute::HULL_HEAT_MULTIPLIER)) / hullAvailable;
 		double hullRemaining = hullAvailable;
 		DoRepair(hull, hullRemaining, MaxHull(),
 			energy, hullEnergy, fuel, hullFuel, heat, hullHeat);
 
-		const double shieldsAvailable = (attributes.Get("shield generation")
-			+ (shieldDelay ? 0 : attributes.Get("delayed shield generation")))
-			* (1. + attributes.Get("shield generation multiplier"))
-			* (1. + attributes.Get("cloaked regen multiplier") * Cloaking());
-		const double shieldsEnergy = (attributes.Get("shield energy")
-			+ (shieldDelay ? 0 : attributes.Get("delayed shield energy")))
-			* (1. + attributes.Get("shield energy multiplier")) / shieldsAvailable;
-		const double shieldsFuel = (attributes.Get("shield fuel")
-			+ (shieldDelay ? 0 : attributes.Get("delayed shield fuel")))
-			* (1. + attributes.Get("shield fuel multiplier")) / shieldsAvailable;
-		const double shieldsHeat = (attributes.Get("shield heat")
-			+ (shieldDelay ? 0 : attributes.Get("delayed shield heat")))
-			* (1. + attributes.Get("shield heat multiplier")) / shieldsAvailable;
+		const double shieldsAvailable = (attributes->Get(Attribute::SHIELD_GENERATION)
+			+ (shieldDelay ? 0 : attributes->Get(Attribute::DELAYED_SHIELD_GENERATION)))
+			* (1. + attributes->Get(Attribute::SHIELD_GENERATION_MULTIPLIER))
+			* (1. + attributes->Get(Attribute::CLOAKED_REGEN_MULTIPLIER) * Cloaking());
+		const double shieldsEnergy = (attributes->Get(Attribute::SHIELD_ENERGY)
+			+ (shieldDelay ? 0 : attributes->Get(Attribute::DELAYED_SHIELD_ENERGY)))
+			* (1. + attributes->Get(Attribute::SHIELD_ENERGY_MULTIPLIER)) / shieldsAvailable;
+		const double shieldsFuel = (attributes->Get(Attribute::SHIELD_FUEL)
+			+ (shieldDelay ? 0 : attributes->Get(Attribute::DELAYED_SHIELD_FUEL)))
+			* (1. + attributes->Get(Attribute::SHIELD_FUEL_MULTIPLIER)) / shieldsAvailable;
+		const double shieldsHeat = (attributes->Get(Attribute::SHIELD_HEAT)
+			+ (shieldDelay ? 0 : attributes->Get(Attribute::DELAYED_SHIELD_HEAT)))
+			* (1. + attributes->Get(Attribute::SHIELD_HEAT_MULTIPLIER)) / shieldsAvailable;
 		double shieldsRemaining = shieldsAvailable;
 		DoRepair(shields, shieldsRemaining, MaxShields(),
 			energy, shieldsEnergy, fuel, shieldsFuel, heat, shieldsHeat);
@@ -4191,15 +4192,15 @@ void Ship::DoGeneration()
 
 			// Now that there is no more need to use energy for hull and shield
 			// repair, if there is still excess energy, transfer it.
-			double energyRemaining = energy - attributes.Get("energy capacity");
-			double fuelRemaining = fuel - attributes.Get("fuel capacity");
+			double energyRemaining = energy - attributes->Get(Attribute::ENERGY_CAPACITY);
+			double fuelRemaining = fuel - attributes->Get(Attribute::FUEL_CAPACITY);
 			for(const pair<double, Ship *> &it : carried)
 			{
 				Ship &ship = *it.second;
 				if(energyRemaining > 0.)
-					DoRepair(ship.energy, energyRemaining, ship.attributes.Get("energy capacity"));
+					DoRepair(ship.energy, energyRemaining, ship.attributes->Get(Attribute::ENERGY_CAPACITY));
 				if(fuelRemaining > 0.)
-					DoRepair(ship.fuel, fuelRemaining, ship.attributes.Get("fuel capacity"));
+					DoRepair(ship.fuel, fuelRemaining, ship.attributes->Get(Attribute::FUEL_CAPACITY));
 			}
 
 			// Carried ships can recharge energy from their parent's batteries,
@@ -4208,7 +4209,7 @@ void Ship::DoGeneration()
 			{
 				Ship &ship = *it.second;
 				if(ship.HasDeployOrder())
-					DoRepair(ship.energy, energy, ship.attributes.Get("energy capacity"));
+					DoRepair(ship.energy, energy, ship.attributes->Get(Attribute::ENERGY_CAPACITY));
 			}
 		}
 		// Decrease the shield and hull delays by 1 now that shield generation
@@ -4217,28 +4218,28 @@ void Ship::DoGeneration()
 		hullDelay = max(0, hullDelay - 1);
 	}
 	// Let the ship repair itself when disabled if it has the appropriate attribute.
-	if(isDisabled && attributes.Get("disabled recovery time"))
+	if(isDisabled && attributes->Get(Attribute::DISABLED_RECOVERY_TIME))
 	{
 		disabledRecoveryCounter += 1;
-		double disabledRepairEnergy = attributes.Get("disabled recovery energy");
-		double disabledRepairFuel = attributes.Get("disabled recovery fuel");
+		double disabledRepairEnergy = attributes->Get(Attribute::DISABLED_RECOVERY_ENERGY);
+		double disabledRepairFuel = attributes->Get(Attribute::DISABLED_RECOVERY_FUEL);
 
 		// Repair only if the counter has reached the limit and if the ship can meet the energy and fuel costs.
-		if(disabledRecoveryCounter >= attributes.Get("disabled recovery time")
+		if(disabledRecoveryCounter >= attributes->Get(Attribute::DISABLED_RECOVERY_TIME)
 			&& energy >= disabledRepairEnergy && fuel >= disabledRepairFuel)
 		{
 			energy -= disabledRepairEnergy;
 			fuel -= disabledRepairFuel;
 
-			heat += attributes.Get("disabled recovery heat");
-			ionization += attributes.Get("disabled recovery ionization");
-			scrambling += attributes.Get("disabled recovery scrambling");
-			disruption += attributes.Get("disabled recovery disruption");
-			slowness += attributes.Get("disabled recovery slowing");
-			discharge += attributes.Get("disabled recovery discharge");
-			corrosion += attributes.Get("disabled recovery corrosion");
-			leakage += attributes.Get("disabled recovery leak");
-			burning += attributes.Get("disabled recovery burning");
+			heat += attributes->Get(Attribute::DISABLED_RECOVERY_HEAT);
+			ionization += attributes->Get(Attribute::DISABLED_RECOVERY_IONIZATION);
+			scrambling += attributes->Get(Attribute::DISABLED_RECOVERY_SCRAMBLING);
+			disruption += attributes->Get(Attribute::DISABLED_RECOVERY_DISRUPTION);
+			slowness += attributes->Get(Attribute::DISABLED_RECOVERY_SLOWING);
+			discharge += attributes->Get(Attribute::DISABLED_RECOVERY_DISCHARGE);
+			corrosion += attributes->Get(Attribute::DISABLED_RECOVERY_CORROSION);
+			leakage += attributes->Get(Attribute::DISABLED_RECOVERY_LEAK);
+			burning += attributes->Get(Attribute::DISABLED_RECOVERY_BURNING);
 
 			disabledRecoveryCounter = 0;
 			hull = min(max(hull, MinimumHull() * 1.5), MaxHull());
@@ -4256,80 +4257,80 @@ void Ship::DoGeneration()
 	// TODO: Mothership gives status resistance to carried ships?
 	if(ionization)
 	{
-		double ionResistance = attributes.Get("ion resistance");
-		double ionEnergy = attributes.Get("ion resistance energy") / ionResistance;
-		double ionFuel = attributes.Get("ion resistance fuel") / ionResistance;
-		double ionHeat = attributes.Get("ion resistance heat") / ionResistance;
+		double ionResistance = attributes->Get(Attribute::ION_RESISTANCE);
+		double ionEnergy = attributes->Get(Attribute::ION_RESISTANCE_ENERGY) / ionResistance;
+		double ionFuel = attributes->Get(Attribute::ION_RESISTANCE_FUEL) / ionResistance;
+		double ionHeat = attributes->Get(Attribute::ION_RESISTANCE_HEAT) / ionResistance;
 		DoStatusEffect(isDisabled, ionization, ionResistance,
 			energy, ionEnergy, fuel, ionFuel, heat, ionHeat);
 	}
 
 	if(scrambling)
 	{
-		double scramblingResistance = attributes.Get("scramble resistance");
-		double scramblingEnergy = attributes.Get("scramble resistance energy") / scramblingResistance;
-		double scramblingFuel = attributes.Get("scramble resistance fuel") / scramblingResistance;
-		double scramblingHeat = attributes.Get("scramble resistance heat") / scramblingResistance;
+		double scramblingResistance = attributes->Get(Attribute::SCRAMBLE_RESISTANCE);
+		double scramblingEnergy = attributes->Get(Attribute::SCRAMBLE_RESISTANCE_ENERGY) / scramblingResistance;
+		double scramblingFuel = attributes->Get(Attribute::SCRAMBLE_RESISTANCE_FUEL) / scramblingResistance;
+		double scramblingHeat = attributes->Get(Attribute::SCRAMBLE_RESISTANCE_HEAT) / scramblingResistance;
 		DoStatusEffect(isDisabled, scrambling, scramblingResistance,
 			energy, scramblingEnergy, fuel, scramblingFuel, heat, scramblingHeat);
 	}
 
 	if(disruption)
 	{
-		double disruptionResistance = attributes.Get("disruption resistance");
-		double disruptionEnergy = attributes.Get("disruption resistance energy") / disruptionResistance;
-		double disruptionFuel = attributes.Get("disruption resistance fuel") / disruptionResistance;
-		double disruptionHeat = attributes.Get("disruption resistance heat") / disruptionResistance;
+		double disruptionResistance = attributes->Get(Attribute::DISRUPTION_RESISTANCE);
+		double disruptionEnergy = attributes->Get(Attribute::DISRUPTION_RESISTANCE_ENERGY) / disruptionResistance;
+		double disruptionFuel = attributes->Get(Attribute::DISRUPTION_RESISTANCE_FUEL) / disruptionResistance;
+		double disruptionHeat = attributes->Get(Attribute::DISRUPTION_RESISTANCE_HEAT) / disruptionResistance;
 		DoStatusEffect(isDisabled, disruption, disruptionResistance,
 			energy, disruptionEnergy, fuel, disruptionFuel, heat, disruptionHeat);
 	}
 
 	if(slowness)
 	{
-		double slowingResistance = attributes.Get("slowing resistance");
-		double slowingEnergy = attributes.Get("slowing resistance energy") / slowingResistance;
-		double slowingFuel = attributes.Get("slowing resistance fuel") / slowingResistance;
-		double slowingHeat = attributes.Get("slowing resistance heat") / slowingResistance;
+		double slowingResistance = attributes->Get(Attribute::SLOWING_RESISTANCE);
+		double slowingEnergy = attributes->Get(Attribute::SLOWING_RESISTANCE_ENERGY) / slowingResistance;
+		double slowingFuel = attributes->Get(Attribute::SLOWING_RESISTANCE_FUEL) / slowingResistance;
+		double slowingHeat = attributes->Get(Attribute::SLOWING_RESISTANCE_HEAT) / slowingResistance;
 		DoStatusEffect(isDisabled, slowness, slowingResistance,
 			energy, slowingEnergy, fuel, slowingFuel, heat, slowingHeat);
 	}
 
 	if(discharge)
 	{
-		double dischargeResistance = attributes.Get("discharge resistance");
-		double dischargeEnergy = attributes.Get("discharge resistance energy") / dischargeResistance;
-		double dischargeFuel = attributes.Get("discharge resistance fuel") / dischargeResistance;
-		double dischargeHeat = attributes.Get("discharge resistance heat") / dischargeResistance;
+		double dischargeResistance = attributes->Get(Attribute::DISCHARGE_RESISTANCE);
+		double dischargeEnergy = attributes->Get(Attribute::DISCHARGE_RESISTANCE_ENERGY) / dischargeResistance;
+		double dischargeFuel = attributes->Get(Attribute::DISCHARGE_RESISTANCE_FUEL) / dischargeResistance;
+		double dischargeHeat = attributes->Get(Attribute::DISCHARGE_RESISTANCE_HEAT) / dischargeResistance;
 		DoStatusEffect(isDisabled, discharge, dischargeResistance,
 			energy, dischargeEnergy, fuel, dischargeFuel, heat, dischargeHeat);
 	}
 
 	if(corrosion)
 	{
-		double corrosionResistance = attributes.Get("corrosion resistance");
-		double corrosionEnergy = attributes.Get("corrosion resistance energy") / corrosionResistance;
-		double corrosionFuel = attributes.Get("corrosion resistance fuel") / corrosionResistance;
-		double corrosionHeat = attributes.Get("corrosion resistance heat") / corrosionResistance;
+		double corrosionResistance = attributes->Get(Attribute::CORROSION_RESISTANCE);
+		double corrosionEnergy = attributes->Get(Attribute::CORROSION_RESISTANCE_ENERGY) / corrosionResistance;
+		double corrosionFuel = attributes->Get(Attribute::CORROSION_RESISTANCE_FUEL) / corrosionResistance;
+		double corrosionHeat = attributes->Get(Attribute::CORROSION_RESISTANCE_HEAT) / corrosionResistance;
 		DoStatusEffect(isDisabled, corrosion, corrosionResistance,
 			energy, corrosionEnergy, fuel, corrosionFuel, heat, corrosionHeat);
 	}
 
 	if(leakage)
 	{
-		double leakResistance = attributes.Get("leak resistance");
-		double leakEnergy = attributes.Get("leak resistance energy") / leakResistance;
-		double leakFuel = attributes.Get("leak resistance fuel") / leakResistance;
-		double leakHeat = attributes.Get("leak resistance heat") / leakResistance;
+		double leakResistance = attributes->Get(Attribute::LEAK_RESISTANCE);
+		double leakEnergy = attributes->Get(Attribute::LEAK_RESISTANCE_ENERGY) / leakResistance;
+		double leakFuel = attributes->Get(Attribute::LEAK_RESISTANCE_FUEL) / leakResistance;
+		double leakHeat = attributes->Get(Attribute::LEAK_RESISTANCE_HEAT) / leakResistance;
 		DoStatusEffect(isDisabled, leakage, leakResistance,
 			energy, leakEnergy, fuel, leakFuel, heat, leakHeat);
 	}
 
 	if(burning)
 	{
-		double burnResistance = attributes.Get("burn resistance");
-		double burnEnergy = attributes.Get("burn resistance energy") / burnResistance;
-		double burnFuel = attributes.Get("burn resistance fuel") / burnResistance;
-		double burnHeat = attributes.Get("burn resistance heat") / burnResistance;
+		double burnResistance = attributes->Get(Attribute::BURN_RESISTANCE);
+		double burnEnergy = attributes->Get(Attribute::BURN_RESISTANCE_ENERGY) / burnResistance;
+		double burnFuel = attributes->Get(Attribute::BURN_RESISTANCE_FUEL) / burnResistance;
+		double burnHeat = attributes->Get(Attribute::BURN_RESISTANCE_HEAT) / burnResistance;
 		DoStatusEffect(isDisabled, burning, burnResistance,
 			energy, burnEnergy, fuel, burnFuel, heat, burnHeat);
 	}
@@ -4338,16 +4339,16 @@ void Ship::DoGeneration()
 	// maximum capacity for the rest of the turn, but must be clamped to the
 	// maximum here before they gain more. This is so that, for example, a ship
 	// with no batteries but a good generator can still move.
-	energy = min(energy, attributes.Get("energy capacity"));
-	fuel = min(fuel, attributes.Get("fuel capacity"));
+	energy = min(energy, attributes->Get(Attribute::ENERGY_CAPACITY));
+	fuel = min(fuel, attributes->Get(Attribute::FUEL_CAPACITY));
 
 	heat -= heat * HeatDissipation();
 	if(heat > MaximumHeat())
 	{
 		isOverheated = true;
-		double heatRatio = Heat() / (1. + attributes.Get("overheat damage threshold"));
+		double heatRatio = Heat() / (1. + attributes->Get(Attribute::OVERHEAT_DAMAGE_THRESHOLD));
 		if(heatRatio > 1.)
-			hull -= attributes.Get("overheat damage rate") * heatRatio;
+			hull -= attributes->Get(Attribute::OVERHEAT_DAMAGE_RATE) * heatRatio;
 	}
 	else if(heat < .9 * MaximumHeat())
 		isOverheated = false;
@@ -4369,34 +4370,35 @@ void Ship::DoGeneration()
 		if(currentSystem)
 		{
 			System::SolarGeneration generation = currentSystem->GetSolarGeneration(position,
-				attributes.Get("ramscoop"), attributes.Get("solar collection"), attributes.Get("solar heat"));
+				attributes->Get(Attribute::RAMSCOOP), attributes->Get(Attribute::SOLAR_COLLECTION),
+				attributes->Get(Attribute::SOLAR_HEAT));
 			fuel += generation.fuel;
 			energy += generation.energy;
 			heat += generation.heat;
 		}
 
 		double coolingEfficiency = CoolingEfficiency();
-		energy += attributes.Get("energy generation") - attributes.Get("energy consumption");
-		fuel += attributes.Get("fuel generation");
-		heat += attributes.Get("heat generation");
-		heat -= coolingEfficiency * attributes.Get("cooling");
+		energy += attributes->Get(Attribute::ENERGY_GENERATION) - attributes->Get(Attribute::ENERGY_CONSUMPTION);
+		fuel += attributes->Get(Attribute::FUEL_GENERATION);
+		heat += attributes->Get(Attribute::HEAT_GENERATION);
+		heat -= coolingEfficiency * attributes->Get(Attribute::COOLING);
 
 		// Convert fuel into energy and heat only when the required amount of fuel is available.
-		if(attributes.Get("fuel consumption") <= fuel)
+		if(attributes->Get(Attribute::FUEL_CONSUMPTION) <= fuel)
 		{
-			fuel -= attributes.Get("fuel consumption");
-			energy += attributes.Get("fuel energy");
-			heat += attributes.Get("fuel heat");
+			fuel -= attributes->Get(Attribute::FUEL_CONSUMPTION);
+			energy += attributes->Get(Attribute::FUEL_ENERGY);
+			heat += attributes->Get(Attribute::FUEL_HEAT);
 		}
 
 		// Apply active cooling. The fraction of full cooling to apply equals
 		// your ship's current fraction of its maximum temperature.
-		double activeCooling = coolingEfficiency * attributes.Get("active cooling");
+		double activeCooling = coolingEfficiency * attributes->Get(Attribute::ACTIVE_COOLING);
 		if(activeCooling > 0. && heat > 0. && energy >= 0.)
 		{
 			// Handle the case where "active cooling"
 			// does not require any energy.
-			double coolingEnergy = attributes.Get("cooling energy");
+			double coolingEnergy = attributes->Get(Attribute::COOLING_ENERGY);
 			if(coolingEnergy)
 			{
 				double spentEnergy = min(energy, coolingEnergy * min(1., Heat()));
@@ -4476,15 +4478,15 @@ void Ship::DoCloakDecision()
 
 	// Attempting to cloak when the cloaking device can no longer operate (because of hull damage)
 	// will result in it being uncloaked.
-	const double minimalHullForCloak = attributes.Get("cloak hull threshold");
-	if(minimalHullForCloak && (hull / attributes.Get("hull") < minimalHullForCloak))
+	const double minimalHullForCloak = attributes->Get(Attribute::CLOAK_HULL_THRESHOLD);
+	if(minimalHullForCloak && (hull / attributes->Get(Attribute::HULL) < minimalHullForCloak))
 		cloakDisruption = 1.;
 
 	const double cloakingSpeed = CloakingSpeed();
-	const double cloakingFuel = attributes.Get("cloaking fuel");
-	const double cloakingEnergy = attributes.Get("cloaking energy");
-	const double cloakingHull = attributes.Get("cloaking hull");
-	const double cloakingShield = attributes.Get("cloaking shields");
+	const double cloakingFuel = attributes->Get(Attribute::CLOAKING_FUEL);
+	const double cloakingEnergy = attributes->Get(Attribute::CLOAKING_ENERGY);
+	const double cloakingHull = attributes->Get(Attribute::CLOAKING_HULL);
+	const double cloakingShield = attributes->Get(Attribute::CLOAKING_SHIELDS);
 	bool canCloak = (!isDisabled && cloakingSpeed > 0. && !cloakDisruption
 		&& fuel >= cloakingFuel && energy >= cloakingEnergy
 		&& MinimumHull() < hull - cloakingHull && shields >= cloakingShield);
@@ -4495,9 +4497,9 @@ void Ship::DoCloakDecision()
 		energy -= cloakingEnergy;
 		shields -= cloakingShield;
 		hull -= cloakingHull;
-		heat += attributes.Get("cloaking heat");
-		double cloakingShieldDelay = attributes.Get("cloaking shield delay");
-		double cloakingHullDelay = attributes.Get("cloaking repair delay");
+		heat += attributes->Get(Attribute::CLOAKING_HEAT);
+		double cloakingShieldDelay = attributes->Get(Attribute::CLOAKING_SHIELD_DELAY);
+		double cloakingHullDelay = attributes->Get(Attribute::CLOAKING_REPAIR_DELAY);
 		cloakingShieldDelay = (cloakingShieldDelay < 1.) ?
 			(Random::Real() <= cloakingShieldDelay) : cloakingShieldDelay;
 		cloakingHullDelay = (cloakingHullDelay < 1.) ?
@@ -4544,7 +4546,7 @@ bool Ship::DoHyperspaceLogic(vector<Visual> &visuals)
 	if(isUsingJumpDrive && !forget)
 	{
 		double sparkAmount = hyperspaceCount * Width() * Height() * .000006;
-		const map<const Effect *, double> &jumpEffects = attributes.JumpEffects();
+		const map<const Effect *, double> &jumpEffects = attributes->JumpEffects();
 		if(jumpEffects.empty())
 			CreateSparks(visuals, "jump drive", sparkAmount);
 		else
@@ -4676,7 +4678,7 @@ bool Ship::DoLandingLogic()
 	if(isDisabled)
 		landingPlanet = nullptr;
 
-	float landingSpeed = attributes.Get("landing speed");
+	float landingSpeed = attributes->Get("landing speed");
 	landingSpeed = landingSpeed > 0 ? landingSpeed : .02f;
 	// Special ships do not disappear forever when they land; they
 	// just slowly refuel.
@@ -4727,7 +4729,7 @@ bool Ship::DoLandingLogic()
 		}
 	}
 	// Only refuel if this planet has a spaceport.
-	else if(fuel >= attributes.Get("fuel capacity")
+	else if(fuel >= attributes->Get("fuel capacity")
 			|| !landingPlanet
 			|| !landingPlanet->GetPort().CanRecharge(Port::RechargeType::Fuel, isYours))
 	{
@@ -4736,7 +4738,7 @@ bool Ship::DoLandingLogic()
 		landingPlanet = nullptr;
 	}
 	else
-		fuel = min(fuel + 1., attributes.Get("fuel capacity"));
+		fuel = min(fuel + 1., attributes->Get("fuel capacity"));
 
 	// Move the ship at the velocity it had when it began landing, but
 	// scaled based on how small it is now.
@@ -4814,23 +4816,23 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 		if(commands.Turn())
 		{
 			// Check if we are able to turn.
-			double cost = attributes.Get("turning energy");
+			double cost = attributes->Get(Attribute::TURNING_ENERGY);
 			if(cost > 0. && energy < cost * fabs(commands.Turn()))
 				commands.SetTurn(copysign(energy / cost, commands.Turn()));
 
-			cost = attributes.Get("turning shields");
+			cost = attributes->Get(Attribute::TURNING_SHIELDS);
 			if(cost > 0. && shields < cost * fabs(commands.Turn()))
 				commands.SetTurn(copysign(shields / cost, commands.Turn()));
 
-			cost = attributes.Get("turning hull");
+			cost = attributes->Get(Attribute::TURNING_HULL);
 			if(cost > 0. && hull < cost * fabs(commands.Turn()))
 				commands.SetTurn(copysign(hull / cost, commands.Turn()));
 
-			cost = attributes.Get("turning fuel");
+			cost = attributes->Get(Attribute::TURNING_FUEL);
 			if(cost > 0. && fuel < cost * fabs(commands.Turn()))
 				commands.SetTurn(copysign(fuel / cost, commands.Turn()));
 
-			cost = -attributes.Get("turning heat");
+			cost = -attributes->Get(Attribute::TURNING_HEAT);
 			if(cost > 0. && heat < cost * fabs(commands.Turn()))
 				commands.SetTurn(copysign(heat / cost, commands.Turn()));
 
@@ -4844,19 +4846,19 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				// of the turning energy and produce a fraction of the heat.
 				double scale = fabs(commands.Turn());
 
-				shields -= scale * attributes.Get("turning shields");
-				hull -= scale * attributes.Get("turning hull");
-				energy -= scale * attributes.Get("turning energy");
-				fuel -= scale * attributes.Get("turning fuel");
-				heat += scale * attributes.Get("turning heat");
-				discharge += scale * attributes.Get("turning discharge");
-				corrosion += scale * attributes.Get("turning corrosion");
-				ionization += scale * attributes.Get("turning ion");
-				scrambling += scale * attributes.Get("turning scramble");
-				leakage += scale * attributes.Get("turning leakage");
-				burning += scale * attributes.Get("turning burn");
-				slowness += scale * attributes.Get("turning slowing");
-				disruption += scale * attributes.Get("turning disruption");
+				shields -= scale * attributes->Get(Attribute::TURNING_SHIELDS);
+				hull -= scale * attributes->Get(Attribute::TURNING_HULL);
+				energy -= scale * attributes->Get(Attribute::TURNING_ENERGY);
+				fuel -= scale * attributes->Get(Attribute::TURNING_FUEL);
+				heat += scale * attributes->Get(Attribute::TURNING_HEAT);
+				discharge += scale * attributes->Get(Attribute::TURNING_DISCHARGE);
+				corrosion += scale * attributes->Get(Attribute::TURNING_CORROSION);
+				ionization += scale * attributes->Get(Attribute::TURNING_ION);
+				scrambling += scale * attributes->Get(Attribute::TURNING_SCRAMBLE);
+				leakage += scale * attributes->Get(Attribute::TURNING_LEAKAGE);
+				burning += scale * attributes->Get(Attribute::TURNING_BURN);
+				slowness += scale * attributes->Get(Attribute::TURNING_SLOWING);
+				disruption += scale * attributes->Get(Attribute::TURNING_DISRUPTION);
 
 				Turn(commands.Turn() * TurnRate() * slowMultiplier);
 			}
@@ -4866,27 +4868,27 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 		if(thrustCommand)
 		{
 			// Check if we are able to apply this thrust.
-			double cost = attributes.Get((thrustCommand > 0.) ?
+			double cost = attributes->Get((thrustCommand > 0.) ?
 				"thrusting energy" : "reverse thrusting energy");
 			if(cost > 0. && energy < cost * fabs(thrustCommand))
 				thrustCommand = copysign(energy / cost, thrustCommand);
 
-			cost = attributes.Get((thrustCommand > 0.) ?
+			cost = attributes->Get((thrustCommand > 0.) ?
 				"thrusting shields" : "reverse thrusting shields");
 			if(cost > 0. && shields < cost * fabs(thrustCommand))
 				thrustCommand = copysign(shields / cost, thrustCommand);
 
-			cost = attributes.Get((thrustCommand > 0.) ?
+			cost = attributes->Get((thrustCommand > 0.) ?
 				"thrusting hull" : "reverse thrusting hull");
 			if(cost > 0. && hull < cost * fabs(thrustCommand))
 				thrustCommand = copysign(hull / cost, thrustCommand);
 
-			cost = attributes.Get((thrustCommand > 0.) ?
+			cost = attributes->Get((thrustCommand > 0.) ?
 				"thrusting fuel" : "reverse thrusting fuel");
 			if(cost > 0. && fuel < cost * fabs(thrustCommand))
 				thrustCommand = copysign(fuel / cost, thrustCommand);
 
-			cost = -attributes.Get((thrustCommand > 0.) ?
+			cost = -attributes->Get((thrustCommand > 0.) ?
 				"thrusting heat" : "reverse thrusting heat");
 			if(cost > 0. && heat < cost * fabs(thrustCommand))
 				thrustCommand = copysign(heat / cost, thrustCommand);
@@ -4896,27 +4898,27 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				// If a reverse thrust is commanded and the capability does not
 				// exist, ignore it (do not even slow under drag).
 				isThrusting = (thrustCommand > 0.);
-				isReversing = !isThrusting && attributes.Get("reverse thrust");
-				thrust = attributes.Get(isThrusting ? "thrust" : "reverse thrust");
+				isReversing = !isThrusting && attributes->Get(Attribute::REVERSE_THRUST);
+				thrust = attributes->Get(isThrusting ? "thrust" : "reverse thrust");
 				IncrementThrusterHeld(isReversing ? ThrustKind::REVERSE : ThrustKind::FORWARD);
 				if(thrust)
 				{
 					double scale = fabs(thrustCommand);
 
-					shields -= scale * attributes.Get(isThrusting ? "thrusting shields" : "reverse thrusting shields");
-					hull -= scale * attributes.Get(isThrusting ? "thrusting hull" : "reverse thrusting hull");
-					energy -= scale * attributes.Get(isThrusting ? "thrusting energy" : "reverse thrusting energy");
-					fuel -= scale * attributes.Get(isThrusting ? "thrusting fuel" : "reverse thrusting fuel");
-					heat += scale * attributes.Get(isThrusting ? "thrusting heat" : "reverse thrusting heat");
-					discharge += scale * attributes.Get(isThrusting ? "thrusting discharge" : "reverse thrusting discharge");
-					corrosion += scale * attributes.Get(isThrusting ? "thrusting corrosion" : "reverse thrusting corrosion");
-					ionization += scale * attributes.Get(isThrusting ? "thrusting ion" : "reverse thrusting ion");
-					scrambling += scale * attributes.Get(isThrusting ? "thrusting scramble" :
+					shields -= scale * attributes->Get(isThrusting ? "thrusting shields" : "reverse thrusting shields");
+					hull -= scale * attributes->Get(isThrusting ? "thrusting hull" : "reverse thrusting hull");
+					energy -= scale * attributes->Get(isThrusting ? "thrusting energy" : "reverse thrusting energy");
+					fuel -= scale * attributes->Get(isThrusting ? "thrusting fuel" : "reverse thrusting fuel");
+					heat += scale * attributes->Get(isThrusting ? "thrusting heat" : "reverse thrusting heat");
+					discharge += scale * attributes->Get(isThrusting ? "thrusting discharge" : "reverse thrusting discharge");
+					corrosion += scale * attributes->Get(isThrusting ? "thrusting corrosion" : "reverse thrusting corrosion");
+					ionization += scale * attributes->Get(isThrusting ? "thrusting ion" : "reverse thrusting ion");
+					scrambling += scale * attributes->Get(isThrusting ? "thrusting scramble" :
 						"reverse thrusting scramble");
-					burning += scale * attributes.Get(isThrusting ? "thrusting burn" : "reverse thrusting burn");
-					leakage += scale * attributes.Get(isThrusting ? "thrusting leakage" : "reverse thrusting leakage");
-					slowness += scale * attributes.Get(isThrusting ? "thrusting slowing" : "reverse thrusting slowing");
-					disruption += scale * attributes.Get(isThrusting ? "thrusting disruption" : "reverse thrusting disruption");
+					burning += scale * attributes->Get(isThrusting ? "thrusting burn" : "reverse thrusting burn");
+					leakage += scale * attributes->Get(isThrusting ? "thrusting leakage" : "reverse thrusting leakage");
+					slowness += scale * attributes->Get(isThrusting ? "thrusting slowing" : "reverse thrusting slowing");
+					disruption += scale * attributes->Get(isThrusting ? "thrusting disruption" : "reverse thrusting disruption");
 
 					acceleration += angle.Unit() * thrustCommand * (isThrusting ? Acceleration() : ReverseAcceleration());
 				}
@@ -4926,22 +4928,22 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				&& !CannotAct(Ship::ActionType::AFTERBURNER);
 		if(applyAfterburner)
 		{
-			thrust = attributes.Get("afterburner thrust");
-			double shieldCost = attributes.Get("afterburner shields");
-			double hullCost = attributes.Get("afterburner hull");
-			double energyCost = attributes.Get("afterburner energy");
-			double fuelCost = attributes.Get("afterburner fuel");
-			double heatCost = -attributes.Get("afterburner heat");
-
-			double dischargeCost = attributes.Get("afterburner discharge");
-			double corrosionCost = attributes.Get("afterburner corrosion");
-			double ionCost = attributes.Get("afterburner ion");
-			double scramblingCost = attributes.Get("afterburner scramble");
-			double leakageCost = attributes.Get("afterburner leakage");
-			double burningCost = attributes.Get("afterburner burn");
-
-			double slownessCost = attributes.Get("afterburner slowing");
-			double disruptionCost = attributes.Get("afterburner disruption");
+			thrust = attributes->Get(Attribute::AFTERBURNER_THRUST);
+			double shieldCost = attributes->Get(Attribute::AFTERBURNER_SHIELDS);
+			double hullCost = attributes->Get(Attribute::AFTERBURNER_HULL);
+			double energyCost = attributes->Get(Attribute::AFTERBURNER_ENERGY);
+			double fuelCost = attributes->Get(Attribute::AFTERBURNER_FUEL);
+			double heatCost = -attributes->Get(Attribute::AFTERBURNER_HEAT);
+
+			double dischargeCost = attributes->Get(Attribute::AFTERBURNER_DISCHARGE);
+			double corrosionCost = attributes->Get(Attribute::AFTERBURNER_CORROSION);
+			double ionCost = attributes->Get(Attribute::AFTERBURNER_ION);
+			double scramblingCost = attributes->Get(Attribute::AFTERBURNER_SCRAMBLE);
+			double leakageCost = attributes->Get(Attribute::AFTERBURNER_LEAKAGE);
+			double burningCost = attributes->Get(Attribute::AFTERBURNER_BURN);
+
+			double slownessCost = attributes->Get(Attribute::AFTERBURNER_SLOWING);
+			double disruptionCost = attributes->Get(Attribute::AFTERBURNER_DISRUPTION);
 
 			if(thrust && shields >= shieldCost && hull >= hullCost
 				&& energy >= energyCost && fuel >= fuelCost && heat >= heatCost)
@@ -4962,7 +4964,7 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 				slowness += slownessCost;
 				disruption += disruptionCost;
 
-				acceleration += angle.Unit() * (1. + attributes.Get("acceleration multiplier")) * thrust / mass;
+				acceleration += angle.Unit() * (1. + attributes->Get(Attribute::ACCELERATION_MULTIPLIER)) * thrust / mass;
 
 				// Only create the afterburner effects if the ship is in the player's system.
 				isUsingAfterburner = !forget;
@@ -4973,7 +4975,8 @@ void Ship::DoMovement(bool &isUsingAfterburner)
 	{
 		acceleration *= slowMultiplier;
 		// Acceleration multiplier needs to modify effective drag, otherwise it changes top speeds.
-		Point dragAcceleration = acceleration - velocity * dragForce * (1. + attributes.Get("acceleration multiplier"));
+		Point dragAcceleration = acceleration
+			- velocity * dragForce * (1. + attributes->Get(Attribute::ACCELERATION_MULTIPLIER));
 		// Make sure dragAcceleration has nonzero length, to avoid divide by zero.
 		if(dragAcceleration)
 		{
@@ -5048,7 +5051,7 @@ void Ship::StepTargeting()
 
 			if(distance < 10. && speed < 1. && ((CanBeCarried() && government == target->government) || !turn))
 			{
-				if(cloak && !attributes.Get("cloaked boarding"))
+				if(cloak && !attributes->Get("cloaked boarding"))
 				{
 					// Allow the player to get all the way to the end of the
 					// boarding sequence (including locking on to the ship) but
@@ -5091,7 +5094,7 @@ void Ship::DoEngineVisuals(vector<Visual> &visuals, bool isUsingAfterburner)
 		double gimbalDirection = (Commands().Has(Command::FORWARD) || Commands().Has(Command::BACK))
 			* -Commands().Turn();
 
-		for(const EnginePoint &point : enginePoints)
+		for(const EnginePoint &point : *enginePoints)
 		{
 			Angle gimbal = Angle(gimbalDirection * point.gimbal.Degrees());
 			Angle afterburnerAngle = angle + point.facing + gimbal;
@@ -5139,24 +5142,14 @@ double Ship::MinimumHull() const
 	if(neverDisabled)
 		return 0.;
 
-	double maximumHull = MaxHull();
-	double absoluteThreshold = attributes.Get("absolute threshold");
-	if(absoluteThreshold > 0.)
-		return absoluteThreshold;
-
-	double thresholdPercent = attributes.Get("threshold percentage");
-	double transition = 1 / (1 + 0.0005 * maximumHull);
-	double minimumHull = maximumHull * (thresholdPercent > 0.
-		? min(thresholdPercent, 1.) : 0.1 * (1. - transition) + 0.5 * transition);
-
-	return max(0., floor(minimumHull + attributes.Get("hull threshold")));
+	return derivedStats.MinimumHull();
 }
 
 
 
 void Ship::CreateExplosion(vector<Visual> &visuals, bool spread)
 {
-	if(!HasSprite() || !GetMask().IsLoaded() || explosionEffects.empty())
+	if(!HasSprite() || !GetMask().IsLoaded() || explosionEffects->empty())
 		return;
 
 	// Bail out if this loops enough times, just in case.
@@ -5168,8 +5161,8 @@ void Ship::CreateExplosion(vector<Visual> &visuals, bool spread)
 		{
 			// Pick an explosion.
 			int type = Random::Int(explosionTotal);
-			auto it = explosionEffects.begin();
-			for( ; it != explosionEffects.end(); ++it)
+			auto it = explosionEffects->begin();
+			for( ; it != explosionEffects->end(); ++it)
 			{
 				type -= it->second;
 				if(type < 0)
@@ -5226,7 +5219,7 @@ void Ship::CreateSparks(vector<Visual> &visuals, const Effect *effect, double am
 
 double Ship::CalculateAttraction() const
 {
-	return max(0., .4 * sqrt(attributes.Get("cargo space")) - 1.8);
+	return max(0., .4 * sqrt(attributes->Get("cargo space")) - 1.8);
 }
 
 
@@ -5260,13 +5253,13 @@ double Ship::CalculateDeterrence() const
 			// Other damage types don't outright destroy ships, so they aren't considered
 			// as heavily in the strength of a weapon.
 			double energyFactor = weapon->EnergyDamage()
-					+ weapon->RelativeEnergyDamage() * attributes.Get("energy capacity")
+					+ weapon->RelativeEnergyDamage() * attributes->Get("energy capacity")
 					+ weapon->IonDamage() * 100.;
 			double heatFactor = weapon->HeatDamage()
 					+ weapon->RelativeHeatDamage() * MaximumHeat()
 					+ weapon->BurnDamage() * 100.;
 			double fuelFactor = weapon->FuelDamage()
-					+ weapon->RelativeFuelDamage() * attributes.Get("fuel capacity")
+					+ weapon->RelativeFuelDamage() * attributes->Get("fuel capacity")
 					+ weapon->LeakDamage() * 100.;
 			double scramblingFactor = weapon->ScramblingDamage() * 100.;
 			double slowingFactor = weapon->SlowingDamage() * 100.;
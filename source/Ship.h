@@ -21,6 +21,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Armament.h"
 #include "CargoHold.h"
 #include "Command.h"
+#include "CopyOnWrite.h"
 #include "EsUuid.h"
 #include "FireCommand.h"
 #include "Outfit.h"
@@ -29,6 +30,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Point.h"
 #include "Port.h"
 #include "ship/ShipAICache.h"
+#include "ship/ShipDerivedStats.h"
 #include "ShipJumpNavigation.h"
 
 #include <array>
@@ -615,7 +617,7 @@ private:
 	std::string variantName;
 	std::string variantMapShopName;
 	std::string noun;
-	Paragraphs description;
+	CopyOnWrite<Paragraphs> description;
 	const Sprite *thumbnail = nullptr;
 	// Characteristics of this particular ship:
 	EsUuid uuid;
@@ -667,12 +669,15 @@ private:
 	const Phrase *hail = nullptr;
 	ShipAICache aiCache;
 
-	// Installed outfits, cargo, etc.:
-	Outfit attributes;
-	Outfit baseAttributes;
+	// Installed outfits, cargo, etc. The attributes and outfits are shared with
+	// the model this ship was created from until they are changed.
+	CopyOnWrite<Outfit> attributes;
+	// Values derived from the attributes, updated whenever they change.
+	ShipDerivedStats derivedStats;
+	CopyOnWrite<Outfit> baseAttributes;
 	bool addAttributes = false;
 	const Weapon *explosionWeapon = nullptr;
-	std::map<const Outfit *, int> outfits;
+	CopyOnWrite<std::map<const Outfit *, int>> outfits;
 	CargoHold cargo;
 	std::list<std::shared_ptr<Flotsam>> jettisoned;
 	std::list<std::pair<std::shared_ptr<Flotsam>, size_t>> jettisonedFromBay;
@@ -681,9 +686,9 @@ private:
 	// Cache the mass of carried ships to avoid repeatedly recomputing it.
 	double carriedMass = 0.;
 
-	std::vector<EnginePoint> enginePoints;
-	std::vector<EnginePoint> reverseEnginePoints;
-	std::vector<EnginePoint> steeringEnginePoints;
+	CopyOnWrite<std::vector<EnginePoint>> enginePoints;
+	CopyOnWrite<std::vector<EnginePoint>> reverseEnginePoints;
+	CopyOnWrite<std::vector<EnginePoint>> steeringEnginePoints;
 	Armament armament;
 
 	// Various energy levels:
@@ -749,15 +754,15 @@ private:
 		int openPeriod = 60;
 		int closePeriod = 60;
 	};
-	std::vector<Leak> leaks;
+	CopyOnWrite<std::vector<Leak>> leaks;
 	std::vector<Leak> activeLeaks;
 
 	// Explosions that happen when the ship is dying:
-	std::map<const Effect *, int> explosionEffects;
+	CopyOnWrite<std::map<const Effect *, int>> explosionEffects;
 	unsigned explosionRate = 0;
 	unsigned explosionCount = 0;
 	unsigned explosionTotal = 0;
-	std::map<const Effect *, int> finalExplosions;
+	CopyOnWrite<std::map<const Effect *, int>> finalExplosions;
 
 	// Target ships, planets, systems, etc.
 	std::weak_ptr<Ship> targetShip;
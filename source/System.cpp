@@ -1023,6 +1023,14 @@ double System::Exports(const string &commodity) const
 
 
 
+System::Price *System::GetPrice(const string &commodity)
+{
+	auto it = trade.find(commodity);
+	return (it == trade.end()) ? nullptr : &it->second;
+}
+
+
+
 // Get the probabilities of various fleets entering this system.
 const vector<RandomEvent<Fleet>> &System::Fleets() const
 {
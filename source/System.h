@@ -72,6 +72,19 @@ public:
 		double heat;
 	};
 
+	// The price and supply of one commodity in this system. Call Update() after
+	// changing the supply to update the price.
+	class Price {
+	public:
+		void SetBase(int base);
+		void Update();
+
+		int base = 0;
+		int price = 0;
+		double supply = 0.;
+		double exports = 0.;
+	};
+
 
 public:
 	// Load a system's description.
@@ -174,6 +187,10 @@ public:
 	void SetSupply(const std::string &commodity, double tons);
 	double Supply(const std::string &commodity) const;
 	double Exports(const std::string &commodity) const;
+	// Get the entry for the given commodity, or null if this system does not trade
+	// it, so that the economy can update it without looking it up every day. The
+	// entry stays valid until this system's trade is changed.
+	Price *GetPrice(const std::string &commodity);
 
 	// Get the probabilities of various fleets entering this system.
 	const std::vector<RandomEvent<Fleet>> &Fleets() const;
@@ -199,19 +216,6 @@ private:
 	void UpdateNeighbors(const Set<System> &systems, double distance);
 
 
-private:
-	class Price {
-	public:
-		void SetBase(int base);
-		void Update();
-
-		int base = 0;
-		int price = 0;
-		double supply = 0.;
-		double exports = 0.;
-	};
-
-
 private:
 	bool isDefined = false;
 	bool hasPosition = false;
@@ -18,6 +18,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "DataFile.h"
 #include "DataNode.h"
 #include "Files.h"
+#include "text/Format.h"
 #include "Information.h"
 #include "Logger.h"
 #include "PlayerInfo.h"
@@ -26,6 +27,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "TaskQueue.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <map>
 #include <ranges>
@@ -60,16 +62,45 @@ shared_future<void> UniverseObjects::Load(TaskQueue &queue, const vector<filesys
 						make_move_iterator(list.end()));
 			}
 
+			// Only text files contain definitions.
+			erase_if(files, [](const filesystem::path &path) { return path.extension() != ".txt"; });
+
+			// Tokenize the files in parallel, but apply them in their original order,
+			// so that later definitions and "overwrite" nodes take effect as before.
+			// Each file's tree is released as soon as it has been applied.
+			vector<DataFile> parsed(files.size());
+			vector<chrono::steady_clock::duration> parseTimes(files.size());
+			vector<shared_future<void>> parsing;
+			parsing.reserve(files.size());
+			TaskQueue parseQueue;
+			for(size_t i = 0; i < files.size(); ++i)
+				parsing.emplace_back(parseQueue.Run([&files, &parsed, &parseTimes, i]() -> void
+					{
+						const auto start = chrono::steady_clock::now();
+						parsed[i].Load(files[i]);
+						parseTimes[i] = chrono::steady_clock::now() - start;
+					}));
+
 			const double step = 1. / (static_cast<int>(files.size()) + 1);
-			for(const auto &path : files)
+			for(size_t i = 0; i < files.size(); ++i)
 			{
-				LoadFile(path, player, globalConditions, debugMode);
+				// A parse task that threw leaves its exception in the queue's sync
+				// tasks, so rethrow it here just as loading this file in place would.
+				parsing[i].wait();
+				parseQueue.ProcessSyncTasks();
+				if(debugMode)
+					Logger::Log("Parsing: " + files[i].string() + " (read in "
+						+ Format::Number(chrono::duration<double, milli>(parseTimes[i]).count(), 2, false) + " ms)",
+						Logger::Level::INFO);
+				LoadFile(files[i], parsed[i], player, globalConditions);
+				parsed[i] = DataFile();
 
 				// Increment the atomic progress by one step.
 				// We use acquire + release to prevent any reordering.
 				auto val = progress.load(memory_order_acquire);
 				progress.store(val + step, memory_order_release);
 			}
+			parseQueue.Wait();
 			FinishLoading();
 			progress = 1.;
 		});
@@ -357,17 +388,9 @@ void UniverseObjects::DrawMenuBackground(Panel *panel) const
 
 
 
-void UniverseObjects::LoadFile(const filesystem::path &path, const PlayerInfo &player,
-		const ConditionsStore *globalConditions, bool debugMode)
+void UniverseObjects::LoadFile(const filesystem::path &path, const DataFile &data,
+		const PlayerInfo &player, const ConditionsStore *globalConditions)
 {
-	// This is an ordinary file. Check to see if it is an image.
-	if(path.extension() != ".txt")
-		return;
-
-	DataFile data(path);
-	if(debugMode)
-		Logger::Log("Parsing: " + path.string(), Logger::Level::INFO);
-
 	const ConditionsStore *playerConditions = &player.Conditions();
 	const set<const System *> *visitedSystems = &player.VisitedSystems();
 	const set<const Planet *> *visitedPlanets = &player.VisitedPlanets();
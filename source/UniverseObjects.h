@@ -60,6 +60,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <vector>
 
 class ConditionsStore;
+class DataFile;
 class Panel;
 class PlayerInfo;
 class Sprite;
@@ -99,8 +100,9 @@ public:
 
 
 private:
-	void LoadFile(const std::filesystem::path &path, const PlayerInfo &player,
-		const ConditionsStore *globalConditions, bool debugMode = false);
+	// Add the definitions in the given file, read from the given path, to the universe.
+	void LoadFile(const std::filesystem::path &path, const DataFile &data,
+		const PlayerInfo &player, const ConditionsStore *globalConditions);
 
 
 private:
@@ -15,7 +15,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "AsyncAudioSupplier.h"
 
-#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <utility>
 
@@ -23,94 +26,209 @@ using namespace std;
 
 
 
-AsyncAudioSupplier::AsyncAudioSupplier(shared_ptr<iostream> data, bool looping)
-	: looping(looping), data(std::move(data))
+/// The threads that decode every async supplier. Each thread repeatedly picks the next
+/// supplier that has room for more chunks, and decodes a little of it.
+class AsyncAudioSupplier::DecodePool {
+public:
+	static DecodePool &Get();
+
+	DecodePool();
+	~DecodePool();
+
+	void Add(AsyncAudioSupplier *supplier);
+	/// Removes the supplier, waiting until no thread is decoding it.
+	void Remove(AsyncAudioSupplier *supplier);
+	/// Wakes up the pool, because a supplier may have room for more chunks. This does not
+	/// take any locks, so it is safe to call from the audio thread.
+	void Notify();
+
+
+private:
+	void Run();
+
+
+private:
+	/// How many threads decode the audio. Decoding is much faster than playback,
+	/// so this only needs to be more than one to keep a slow file from holding up the rest.
+	static constexpr unsigned THREAD_COUNT = 2;
+	/// Notify() does not take the lock, so a wakeup may be missed by a thread that is
+	/// just about to wait. That thread checks again after this long.
+	static constexpr chrono::milliseconds WAKEUP_INTERVAL{10};
+
+	mutex suppliersMutex;
+	condition_variable condition;
+	vector<AsyncAudioSupplier *> suppliers;
+	/// The index of the next supplier to look at, so that every supplier gets a turn.
+	size_t next = 0;
+	atomic<bool> hasWork = false;
+	bool shouldQuit = false;
+	vector<thread> threads;
+};
+
+
+
+AsyncAudioSupplier::DecodePool &AsyncAudioSupplier::DecodePool::Get()
 {
+	static DecodePool pool;
+	return pool;
 }
 
 
 
-AsyncAudioSupplier::~AsyncAudioSupplier()
+AsyncAudioSupplier::DecodePool::DecodePool()
+{
+	for(unsigned i = 0; i < THREAD_COUNT; ++i)
+		threads.emplace_back(&DecodePool::Run, this);
+}
+
+
+
+AsyncAudioSupplier::DecodePool::~DecodePool()
 {
-	// Tell the decoding thread to stop.
 	{
-		lock_guard<mutex> lock(bufferMutex);
-		done = true;
+		lock_guard<mutex> lock(suppliersMutex);
+		shouldQuit = true;
 	}
-	bufferCondition.notify_all();
-	if(audioThread.joinable())
-		audioThread.join();
+	condition.notify_all();
+	for(thread &thread : threads)
+		thread.join();
 }
 
 
 
-size_t AsyncAudioSupplier::MaxChunks() const
+void AsyncAudioSupplier::DecodePool::Add(AsyncAudioSupplier *supplier)
 {
-	if(done && buffer.size() < OUTPUT_CHUNK)
-		return 0;
+	{
+		lock_guard<mutex> lock(suppliersMutex);
+		suppliers.push_back(supplier);
+		supplier->isRegistered = true;
+	}
+	condition.notify_one();
+}
 
-	return max(static_cast<size_t>(2), AvailableChunks());
+
+
+void AsyncAudioSupplier::DecodePool::Remove(AsyncAudioSupplier *supplier)
+{
+	unique_lock<mutex> lock(suppliersMutex);
+	if(!supplier->isRegistered)
+		return;
+
+	condition.wait(lock, [supplier] { return !supplier->isDecoding; });
+	erase(suppliers, supplier);
+	supplier->isRegistered = false;
 }
 
 
 
-size_t AsyncAudioSupplier::AvailableChunks() const
+void AsyncAudioSupplier::DecodePool::Notify()
 {
-	return buffer.size() / OUTPUT_CHUNK;
+	hasWork.store(true, memory_order_relaxed);
+	condition.notify_one();
 }
 
 
-vector<AudioSupplier::sample_t> AsyncAudioSupplier::NextDataChunk()
+
+void AsyncAudioSupplier::DecodePool::Run()
 {
-	if(AvailableChunks())
+	unique_lock<mutex> lock(suppliersMutex);
+	while(!shouldQuit)
 	{
-		lock_guard<mutex> lock(bufferMutex);
-
-		vector<sample_t> temp{buffer.begin(), buffer.begin() + OUTPUT_CHUNK};
-		buffer.erase(buffer.begin(), buffer.begin() + OUTPUT_CHUNK);
-		bufferCondition.notify_all();
-		return temp;
+		hasWork.store(false, memory_order_relaxed);
+		AsyncAudioSupplier *supplier = nullptr;
+		for(size_t i = 0; i < suppliers.size() && !supplier; ++i)
+		{
+			AsyncAudioSupplier *candidate = suppliers[(next + i) % suppliers.size()];
+			if(!candidate->isDecoding && candidate->NeedsDecoding())
+			{
+				supplier = candidate;
+				next = (next + i + 1) % suppliers.size();
+			}
+		}
+		if(!supplier)
+		{
+			if(!hasWork.load(memory_order_relaxed))
+				condition.wait_for(lock, WAKEUP_INTERVAL);
+			continue;
+		}
+
+		supplier->isDecoding = true;
+		lock.unlock();
+		supplier->DecodeStep();
+		lock.lock();
+		supplier->isDecoding = false;
+		// Let Remove() know that this supplier is no longer being decoded.
+		condition.notify_all();
 	}
-	else
-		return vector<sample_t>(OUTPUT_CHUNK);
 }
 
 
 
-void AsyncAudioSupplier::StartAudioThread()
+AsyncAudioSupplier::AsyncAudioSupplier(shared_ptr<iostream> data, bool looping)
+	: looping(looping), data(std::move(data)), chunks(BUFFER_CHUNK_SIZE, OUTPUT_CHUNK)
 {
-	audioThread = thread(&AsyncAudioSupplier::Decode, this);
+	current.reserve(OUTPUT_CHUNK);
+	pending.reserve(OUTPUT_CHUNK);
 }
 
 
 
-void AsyncAudioSupplier::AwaitBufferSpace()
+AsyncAudioSupplier::~AsyncAudioSupplier()
 {
-	unique_lock<mutex> lock(bufferMutex);
-	while(!done && buffer.size() > (BUFFER_CHUNK_SIZE - 1) * OUTPUT_CHUNK)
-		bufferCondition.wait(lock);
+	// The derived class should have already done this, as it can't be decoded after its destruction.
+	StopDecoding();
 }
 
 
 
-void AsyncAudioSupplier::AddBufferData(vector<sample_t> &samples)
+size_t AsyncAudioSupplier::MaxChunks() const
 {
-	lock_guard<mutex> lock(bufferMutex);
-	buffer.insert(buffer.end(), samples.begin(), samples.end());
-	samples.clear();
-	if(done)
-		PadBuffer();
+	if(finished.load(memory_order_acquire) && !AvailableChunks())
+		return 0;
+
+	return max(static_cast<size_t>(2), AvailableChunks());
+}
+
+
+
+size_t AsyncAudioSupplier::AvailableChunks() const
+{
+	return chunks.Size();
+}
+
+
+
+void AsyncAudioSupplier::NextDataChunk(vector<sample_t> &chunk)
+{
+	if(chunks.Pop(chunk))
+		DecodePool::Get().Notify();
+	else
+		chunk.assign(OUTPUT_CHUNK, 0);
 }
 
 
 
-void AsyncAudioSupplier::PadBuffer()
+void AsyncAudioSupplier::StartDecoding()
 {
-	buffer.resize(OUTPUT_CHUNK * ceil(static_cast<double>(buffer.size()) / static_cast<double>(OUTPUT_CHUNK)));
+	DecodePool::Get().Add(this);
 }
 
 
 
+void AsyncAudioSupplier::StopDecoding()
+{
+	DecodePool::Get().Remove(this);
+}
+
+
+
+void AsyncAudioSupplier::AddBufferData(vector<sample_t> &samples)
+{
+	pending.insert(pending.end(), samples.begin(), samples.end());
+	samples.clear();
+}
+
+
 
 size_t AsyncAudioSupplier::ReadInput(char *output, size_t bytesToRead)
 {
@@ -129,3 +247,63 @@ size_t AsyncAudioSupplier::ReadInput(char *output, size_t bytesToRead)
 		done = true;
 	return read;
 }
+
+
+
+bool AsyncAudioSupplier::NeedsDecoding() const
+{
+	if(finished.load(memory_order_relaxed))
+		return false;
+	// Once the decoder is done, only the last chunk is left to queue.
+	if(decoderDone)
+		return !chunks.Full();
+	return current.size() < OUTPUT_CHUNK || !chunks.Full();
+}
+
+
+
+void AsyncAudioSupplier::DecodeStep()
+{
+	Flush();
+	if(!decoderDone && current.size() < OUTPUT_CHUNK)
+		decoderDone = !Decode();
+	Flush();
+
+	if(decoderDone && pending.empty())
+	{
+		// Pad the last chunk with silence.
+		if(!current.empty())
+		{
+			current.resize(OUTPUT_CHUNK);
+			if(!chunks.Push(current))
+				return;
+			current.clear();
+		}
+		finished.store(true, memory_order_release);
+	}
+}
+
+
+
+void AsyncAudioSupplier::Flush()
+{
+	size_t flushed = 0;
+	while(true)
+	{
+		if(current.size() == OUTPUT_CHUNK)
+		{
+			if(!chunks.Push(current))
+				break;
+			// The queue handed back a buffer that the consumer is done with.
+			current.clear();
+			current.reserve(OUTPUT_CHUNK);
+		}
+		if(flushed == pending.size())
+			break;
+
+		size_t count = min(OUTPUT_CHUNK - current.size(), pending.size() - flushed);
+		current.insert(current.end(), pending.begin() + flushed, pending.begin() + flushed + count);
+		flushed += count;
+	}
+	pending.erase(pending.begin(), pending.begin() + flushed);
+}
@@ -17,14 +17,18 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "AudioSupplier.h"
 
-#include <condition_variable>
+#include "ChunkQueue.h"
+
+#include <atomic>
 #include <iostream>
 #include <memory>
-#include <thread>
 
 
 
 /// Generic implementation for async suppliers that stream data decoded on another thread.
+/// All of them share a small pool of decoding threads, which take turns decoding a little
+/// of every supplier that has room for more chunks. The decoded chunks are handed to the
+/// consumer through a lock-free queue that recycles their memory.
 class AsyncAudioSupplier : public AudioSupplier {
 public:
 	explicit AsyncAudioSupplier(std::shared_ptr<std::iostream> data, bool looping = false);
@@ -33,20 +37,22 @@ public:
 	// Inherited pure virtual methods
 	size_t MaxChunks() const override;
 	size_t AvailableChunks() const override;
-	std::vector<sample_t> NextDataChunk() override;
+	void NextDataChunk(std::vector<sample_t> &chunk) override;
 
 
 protected:
-	void StartAudioThread();
-	/// This is the entry point for the decoding thread.
-	virtual void Decode() = 0;
+	/// Adds this supplier to the decoding pool. Call this once the derived class is fully constructed.
+	void StartDecoding();
+	/// Removes this supplier from the decoding pool, waiting for the decoding in progress (if any)
+	/// to finish. Call this first thing in the destructor of the derived class.
+	void StopDecoding();
+	/// Decodes a small part of the input, such as a single frame, and adds it via AddBufferData().
+	/// Returns false once there is nothing left to decode. This is called from the decoding pool,
+	/// but never from more than one thread at a time.
+	virtual bool Decode() = 0;
 
-	void AwaitBufferSpace();
 	/// Adds data to the output buffer, then clears the given sample vector.
-	/// If the supplier is done, pads the output buffer to a full chunk with silence.
 	void AddBufferData(std::vector<sample_t> &samples);
-	/// Pads the buffer to a full output chunk with silence.
-	void PadBuffer();
 
 	/// Reads file input. Returns the number of bytes read.
 	/// The returned byte count is only less than the requested number if the end of the input was reached.
@@ -61,14 +67,32 @@ protected:
 	std::shared_ptr<std::iostream> data;
 
 
+private:
+	class DecodePool;
+
+	/// Whether the decoding pool should call DecodeStep() for this supplier.
+	bool NeedsDecoding() const;
+	/// Decodes some more data if there is room for it, and queues up any full chunks.
+	void DecodeStep();
+	/// Moves as much of the decoded data as possible into the queued chunks.
+	void Flush();
+
+
 private:
 	/// The number of chunks to queue up in the buffer.
 	static constexpr size_t BUFFER_CHUNK_SIZE = 3;
-	/// The decoded data.
-	std::vector<sample_t> buffer;
-
-	// Sync management
-	std::thread audioThread;
-	std::mutex bufferMutex;
-	std::condition_variable bufferCondition;
+	/// The decoded chunks, ready for playback.
+	ChunkQueue chunks;
+	/// The chunk that is being filled with decoded data.
+	std::vector<sample_t> current;
+	/// The decoded data that does not fit into the current chunk.
+	std::vector<sample_t> pending;
+	/// Whether the decoder has no more data to add.
+	bool decoderDone = false;
+	/// Whether all the decoded data has been queued for playback.
+	std::atomic<bool> finished = false;
+
+	// Guarded by the decoding pool's mutex:
+	bool isDecoding = false;
+	bool isRegistered = false;
 };
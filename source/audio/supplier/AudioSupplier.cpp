@@ -53,17 +53,17 @@ void AudioSupplier::NextChunk(ALuint buffer, bool spatial)
 {
 	if(AvailableChunks())
 	{
-		vector<sample_t> samples = NextDataChunk();
+		NextDataChunk(chunk);
 		// Spatial audio is mono, but we get stereo data by default.
 		// (This difference is due to a limitation in OpenAL.)
 		if(spatial)
 		{
-			for(size_t i = 0; i < samples.size() / 2; ++i)
-				samples[i] = (static_cast<int>(samples[2 * i]) + static_cast<int>(samples[2 * i + 1])) / 2;
-			samples.resize(samples.size() / 2);
+			for(size_t i = 0; i < chunk.size() / 2; ++i)
+				chunk[i] = (static_cast<int>(chunk[2 * i]) + static_cast<int>(chunk[2 * i + 1])) / 2;
+			chunk.resize(chunk.size() / 2);
 		}
-		alBufferData(buffer, spatial ? FORMAT_SPATIAL : FORMAT, samples.data(),
-			sizeof(sample_t) * samples.size(), SAMPLE_RATE);
+		alBufferData(buffer, spatial ? FORMAT_SPATIAL : FORMAT, chunk.data(),
+			sizeof(sample_t) * chunk.size(), SAMPLE_RATE);
 	}
 	else
 		SetSilence(buffer, OUTPUT_CHUNK);
@@ -73,6 +73,9 @@ void AudioSupplier::NextChunk(ALuint buffer, bool spatial)
 
 void AudioSupplier::SetSilence(ALuint buffer, size_t samples)
 {
-	vector<sample_t> data(samples);
-	alBufferData(buffer, FORMAT, data.data(), sizeof(sample_t) * samples, SAMPLE_RATE);
+	// Audio is only played from the main thread, so the silence can be shared.
+	static vector<sample_t> silence;
+	if(silence.size() < samples)
+		silence.resize(samples);
+	alBufferData(buffer, FORMAT, silence.data(), sizeof(sample_t) * samples, SAMPLE_RATE);
 }
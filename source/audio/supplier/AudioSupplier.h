@@ -45,9 +45,11 @@ public:
 	virtual size_t MaxChunks() const = 0;
 	/// The number of chunks currently ready for access via NextChunk().
 	virtual size_t AvailableChunks() const = 0;
-	/// Gets the next, fixed-size chunk of audio samples. If there is no available chunk, a silence chunk is returned.
-	/// This returns the raw samples that would be put into an OpenAL buffer via a NextChunk() call.
-	virtual std::vector<sample_t> NextDataChunk() = 0;
+	/// Replaces the given samples with the next, fixed-size chunk of audio. If there is no available chunk,
+	/// it is filled with silence. These are the raw samples that would be put into an OpenAL buffer via a
+	/// NextChunk() call. The given vector's memory may be reused by the supplier, so reusing the same vector
+	/// for every call avoids allocating a new one per chunk.
+	virtual void NextDataChunk(std::vector<sample_t> &chunk) = 0;
 
 	/// Configures 3x audio playback.
 	virtual void Set3x(bool is3x);
@@ -86,4 +88,9 @@ protected:
 
 	/// The index of the first sample to be processed
 	size_t currentSample = 0;
+
+
+private:
+	/// The samples of the last chunk put into an OpenAL buffer, kept to reuse their memory.
+	std::vector<sample_t> chunk;
 };
@@ -0,0 +1,70 @@
+/* ChunkQueue.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ChunkQueue.h"
+
+using namespace std;
+
+
+
+ChunkQueue::ChunkQueue(size_t capacity, size_t chunkSize)
+	: slots(capacity)
+{
+	for(vector<AudioSupplier::sample_t> &slot : slots)
+		slot.reserve(chunkSize);
+}
+
+
+
+bool ChunkQueue::Push(vector<AudioSupplier::sample_t> &chunk)
+{
+	const size_t count = pushed.load(memory_order_relaxed);
+	if(count - popped.load(memory_order_acquire) == slots.size())
+		return false;
+
+	// The consumer has released this slot, so whatever buffer it holds is unused.
+	slots[count % slots.size()].swap(chunk);
+	pushed.store(count + 1, memory_order_release);
+	return true;
+}
+
+
+
+bool ChunkQueue::Pop(vector<AudioSupplier::sample_t> &chunk)
+{
+	const size_t count = popped.load(memory_order_relaxed);
+	if(count == pushed.load(memory_order_acquire))
+		return false;
+
+	slots[count % slots.size()].swap(chunk);
+	popped.store(count + 1, memory_order_release);
+	return true;
+}
+
+
+
+size_t ChunkQueue::Size() const
+{
+	// Load the popped count first, so that the result can never be negative.
+	const size_t count = popped.load(memory_order_acquire);
+	return pushed.load(memory_order_acquire) - count;
+}
+
+
+
+bool ChunkQueue::Full() const
+{
+	return Size() >= slots.size();
+}
@@ -0,0 +1,56 @@
+/* ChunkQueue.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "AudioSupplier.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+
+
+/// A fixed-capacity, lock-free queue of audio chunks between exactly one producer thread
+/// and one consumer thread. Chunks are exchanged by swapping vectors, so the buffer that
+/// is handed in takes the place of the one handed out, and once every buffer has grown
+/// to the chunk size, no memory is allocated or freed.
+class ChunkQueue {
+public:
+	/// Creates a queue of the given capacity, with every slot holding a buffer
+	/// that is already large enough for a chunk of the given size.
+	ChunkQueue(size_t capacity, size_t chunkSize);
+	ChunkQueue(const ChunkQueue &) = delete;
+	ChunkQueue &operator=(const ChunkQueue &) = delete;
+
+	/// Producer: adds the given chunk to the queue, and replaces it with an unused buffer.
+	/// Returns false (leaving the chunk untouched) if the queue is full.
+	bool Push(std::vector<AudioSupplier::sample_t> &chunk);
+	/// Consumer: replaces the given buffer with the oldest chunk in the queue, which
+	/// then reuses the given buffer. Returns false (leaving it untouched) if the queue is empty.
+	bool Pop(std::vector<AudioSupplier::sample_t> &chunk);
+
+	/// The number of chunks in the queue. Exact for the consumer and the producer, as
+	/// the other thread can only make it larger or smaller, respectively.
+	size_t Size() const;
+	bool Full() const;
+
+
+private:
+	std::vector<std::vector<AudioSupplier::sample_t>> slots;
+	/// The number of chunks ever pushed and popped. Each is only written by one thread.
+	std::atomic<size_t> pushed = 0;
+	std::atomic<size_t> popped = 0;
+};
@@ -26,7 +26,15 @@ using namespace std;
 FlacSupplier::FlacSupplier(shared_ptr<iostream> data, bool looping)
 	: AsyncAudioSupplier(std::move(data), looping)
 {
-	StartAudioThread();
+	init();
+	StartDecoding();
+}
+
+
+
+FlacSupplier::~FlacSupplier()
+{
+	StopDecoding();
 }
 
 
@@ -36,8 +44,6 @@ FLAC__StreamDecoderWriteStatus FlacSupplier::write_callback(const FLAC__Frame *f
 	const size_t channels = frame->header.channels;
 	const size_t blocksize = frame->header.blocksize;
 
-	AwaitBufferSpace();
-	static vector<sample_t> samples;
 	for(size_t i = 0; i < blocksize; ++i)
 		for(size_t ch = 0; ch < channels; ++ch)
 			samples.push_back(static_cast<sample_t>(buffer[ch][i]));
@@ -78,7 +84,6 @@ void FlacSupplier::error_callback(FLAC__StreamDecoderErrorStatus status)
 {
 	Logger::Log("FLAC error " + string(FLAC__StreamDecoderErrorStatusString[status]), Logger::Level::WARNING);
 	done = true;
-	PadBuffer();
 }
 
 
@@ -124,13 +129,24 @@ bool FlacSupplier::eof_callback()
 
 
 
-void FlacSupplier::Decode()
+bool FlacSupplier::Decode()
 {
-	init();
-	do {
+	if(get_state() == FLAC__STREAM_DECODER_END_OF_STREAM)
+	{
+		// If the end of a looping file was reached, start over from the beginning.
+		if(done || !lastReadWasEof)
+		{
+			finish();
+			return false;
+		}
 		lastReadWasEof = false;
-		process_until_end_of_stream();
 		reset();
-	} while(!done && lastReadWasEof);
-	finish();
+	}
+
+	if(!process_single())
+	{
+		finish();
+		return false;
+	}
+	return true;
 }
@@ -19,14 +19,17 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <FLAC++/decoder.h>
 
+#include <vector>
+
 
 
 /// Streams audio from a FLAC file.
 class FlacSupplier : protected FLAC::Decoder::Stream, public AsyncAudioSupplier {
-// Maintenance note: the order of the parents is important. AsyncAudioSupplier must be destructed first,
-// otherwise the FLAC::Decoder::Stream may free the resources with the decoder thread running.
+// Maintenance note: the decoding must be stopped before either parent is destructed,
+// otherwise the FLAC::Decoder::Stream may free the resources while a frame is being decoded.
 public:
 	explicit FlacSupplier(std::shared_ptr<std::iostream> data, bool looping = false);
+	~FlacSupplier() override;
 
 
 private:
@@ -45,11 +48,13 @@ private:
 	FLAC__StreamDecoderLengthStatus length_callback(FLAC__uint64 *stream_length) override;
 	bool eof_callback() override;
 
-	/// This is the entry point for the decoding thread.
-	void Decode() override;
+	/// Decodes the next FLAC frame.
+	bool Decode() override;
 
 
 private:
 	/// If the last read reached the end of the file, we may have to loop back by resetting the decoder.
 	bool lastReadWasEof = false;
+	/// The samples of the last decoded frame.
+	std::vector<sample_t> samples;
 };
@@ -17,15 +17,34 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "AsyncAudioSupplier.h"
 
+#include <mad.h>
+
+#include <array>
+#include <vector>
+
 
 
 /// Streams audio from an MP3 file.
 class Mp3Supplier : public AsyncAudioSupplier {
 public:
 	explicit Mp3Supplier(std::shared_ptr<std::iostream> data, bool looping = false);
+	~Mp3Supplier() override;
+
+
+private:
+	/// Decodes the next MP3 frame.
+	bool Decode() override;
+	/// Reads the next block of input into the stream decoder. Returns false if there is none.
+	bool ReadBlock();
 
 
 private:
-	/// This is the entry point for the decoding thread.
-	void Decode() override;
+	/// The input from the file.
+	std::array<unsigned char, INPUT_CHUNK> input{};
+	/// The samples of the last decoded frame.
+	std::vector<sample_t> samples;
+	// Objects for MP3 decoding:
+	mad_stream stream;
+	mad_frame frame;
+	mad_synth synth;
 };
@@ -50,12 +50,12 @@ size_t WavSupplier::AvailableChunks() const
 
 
 
-vector<AudioSupplier::sample_t> WavSupplier::NextDataChunk()
+void WavSupplier::NextDataChunk(vector<sample_t> &samples)
 {
-	vector<sample_t> samples(OUTPUT_CHUNK);
+	samples.assign(OUTPUT_CHUNK, 0);
 	// If we are at the beginning of the buffer and it was already played, this is a loop.
 	if(!currentSample && wasStarted && !isLooping)
-		return samples;
+		return;
 
 	size_t currentSampleCount = 0;
 	do {
@@ -71,6 +71,5 @@ vector<AudioSupplier::sample_t> WavSupplier::NextDataChunk()
 		currentSampleCount += readChunk;
 		currentSample = (currentSample + readChunk) % input.size();
 	} while(currentSampleCount < samples.size() && isLooping);
-	return samples;
 }
 
@@ -29,7 +29,7 @@ public:
 	// Inherited pure virtual methods
 	size_t MaxChunks() const override;
 	size_t AvailableChunks() const override;
-	std::vector<sample_t> NextDataChunk() override;
+	void NextDataChunk(std::vector<sample_t> &chunk) override;
 
 
 private:
@@ -65,32 +65,31 @@ size_t Fade::AvailableChunks() const
 
 
 
-vector<AudioSupplier::sample_t> Fade::NextDataChunk()
+void Fade::NextDataChunk(vector<sample_t> &result)
 {
-	vector<sample_t> result;
 	if(!primarySource && fadeProgress.empty())
 		// With no input sources, output silence.
-		result = vector<sample_t>(OUTPUT_CHUNK);
+		result.assign(OUTPUT_CHUNK, 0);
 	else if(primarySource && fadeProgress.empty())
 		// With only primary input (nothing to blend with), output primary.
-		result = primarySource->NextDataChunk();
+		primarySource->NextDataChunk(result);
 	else // fade sources
 	{
 		// Generate the faded background.
-		vector<sample_t> faded = std::get<0>(fadeProgress[0])->NextDataChunk();
+		std::get<0>(fadeProgress[0])->NextDataChunk(faded);
 		for(size_t i = 1; i < fadeProgress.size(); ++i)
 		{
-			vector<sample_t> other = std::get<0>(fadeProgress[i])->NextDataChunk();
+			std::get<0>(fadeProgress[i])->NextDataChunk(other);
 			auto &[source, fade, fadePerFrame] = fadeProgress[i - 1];
 			CrossFade(faded, other, fade, fadePerFrame);
-			faded = std::move(other);
+			faded.swap(other);
 		}
 
 		// Get the foreground data.
 		if(primarySource)
-			result = primarySource->NextDataChunk();
+			primarySource->NextDataChunk(result);
 		else
-			result.resize(OUTPUT_CHUNK); // silence
+			result.assign(OUTPUT_CHUNK, 0); // silence
 
 		// The final blend.
 		auto &[source, fade, fadePerFrame] = fadeProgress.back();
@@ -100,9 +99,7 @@ vector<AudioSupplier::sample_t> Fade::NextDataChunk()
 	// Clean up the finished sources.
 	if(primarySource && !primarySource->MaxChunks())
 		primarySource.reset();
-	erase_if(fadeProgress, [](const auto &faded){ return !std::get<1>(faded) || !std::get<0>(faded)->MaxChunks(); });
-
-	return result;
+	erase_if(fadeProgress, [](const auto &entry){ return !std::get<1>(entry) || !std::get<0>(entry)->MaxChunks(); });
 }
 
 
@@ -43,7 +43,7 @@ public:
 	// Inherited pure virtual methods
 	size_t MaxChunks() const override;
 	size_t AvailableChunks() const override;
-	std::vector<sample_t> NextDataChunk() override;
+	void NextDataChunk(std::vector<sample_t> &chunk) override;
 
 
 private:
@@ -57,4 +57,8 @@ private:
 	std::vector<std::tuple<std::unique_ptr<AudioSupplier>, size_t, size_t>> fadeProgress;
 	/// The primary source; this one is not faded out by itself, but can be cross-faded with the other sources.
 	std::unique_ptr<AudioSupplier> primarySource;
+
+	/// The chunks of the sources being faded, kept to reuse their memory.
+	std::vector<sample_t> faded;
+	std::vector<sample_t> other;
 };
@@ -0,0 +1,281 @@
+/* ImageCache.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ImageCache.h"
+
+#include "../Files.h"
+#include "ImageBuffer.h"
+#include "../Logger.h"
+#include "Mask.h"
+#include "../Point.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+	// Identifies a cache entry, and the version of its layout. If the layout
+	// changes, the version must be incremented so that old entries are rebuilt.
+	constexpr char MAGIC[4] = {'E', 'S', 'I', 'C'};
+	constexpr uint32_t VERSION = 1;
+
+	bool enabled = false;
+	filesystem::path directory;
+
+	// The information about an image file that determines whether its cache
+	// entry is still valid.
+	struct Source {
+		string path;
+		uint64_t size = 0;
+		int64_t time = 0;
+	};
+
+	// Get the cache key for the given image file. This fails if the file is
+	// not a regular file on disk, e.g. if it is inside a zipped plugin.
+	bool GetSource(const filesystem::path &path, Source &source)
+	{
+		error_code error;
+		if(!filesystem::is_regular_file(path, error))
+			return false;
+		source.size = filesystem::file_size(path, error);
+		if(error)
+			return false;
+		source.time = filesystem::last_write_time(path, error).time_since_epoch().count();
+		if(error)
+			return false;
+		source.path = path.generic_string();
+		return true;
+	}
+
+	filesystem::path EntryPath(const Source &source)
+	{
+		char name[24];
+		snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash<string>{}(source.path)));
+		return directory / (string(name) + ".bin");
+	}
+
+	template<class Type>
+	void WriteValue(ostream &out, const Type &value)
+	{
+		out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+
+	template<class Type>
+	bool ReadValue(istream &in, Type &value)
+	{
+		return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(value)));
+	}
+}
+
+
+
+void ImageCache::Enable()
+{
+	directory = Files::Config() / "image cache";
+	error_code error;
+	filesystem::create_directories(directory, error);
+	if(error)
+	{
+		Logger::Log("Unable to create the image cache directory \"" + directory.string() + "\": "
+			+ error.message(), Logger::Level::WARNING);
+		return;
+	}
+	enabled = true;
+}
+
+
+
+bool ImageCache::IsEnabled()
+{
+	return enabled;
+}
+
+
+
+int ImageCache::Read(const filesystem::path &path, ImageBuffer &buffer, int frame, Mask *mask)
+{
+	Source source;
+	if(!enabled || !GetSource(path, source))
+		return 0;
+
+	ifstream in(EntryPath(source), ios::in | ios::binary);
+	if(!in)
+		return 0;
+
+	// Check that the entry is for this exact version of this file.
+	char magic[sizeof(MAGIC)];
+	uint32_t version = 0;
+	Source cached;
+	uint32_t pathLength = 0;
+	if(!in.read(magic, sizeof(magic)) || !equal(begin(magic), end(magic), begin(MAGIC))
+			|| !ReadValue(in, version) || version != VERSION
+			|| !ReadValue(in, cached.size) || cached.size != source.size
+			|| !ReadValue(in, cached.time) || cached.time != source.time
+			|| !ReadValue(in, pathLength) || pathLength != source.path.size())
+		return 0;
+	cached.path.resize(pathLength);
+	if(!in.read(cached.path.data(), pathLength) || cached.path != source.path)
+		return 0;
+
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t frames = 0;
+	uint8_t hasMask = 0;
+	if(!ReadValue(in, width) || !ReadValue(in, height) || !ReadValue(in, frames) || !ReadValue(in, hasMask)
+			|| width <= 0 || height <= 0 || frames <= 0 || (mask && !hasMask))
+		return 0;
+
+	// The entry must fit in the buffer without disturbing any frames that were
+	// already loaded into it. An image sequence determines the number of frames
+	// in the buffer, just like when it is decoded, so it can only be read into
+	// a buffer that has not been allocated yet.
+	const bool isAllocated = buffer.Pixels();
+	if(isAllocated ? (width != buffer.Width() || height != buffer.Height() || frame + frames > buffer.Frames())
+			: (frames > 1 ? frame != 0 : frame >= buffer.Frames()))
+		return 0;
+
+	// Make sure the file holds exactly the pixels and mask it claims to,
+	// before reading anything into the buffer.
+	const streamoff pixelStart = in.tellg();
+	in.seekg(0, ios::end);
+	const streamoff fileEnd = in.tellg();
+	const streamoff pixelBytes = static_cast<streamoff>(width) * height * frames * sizeof(uint32_t);
+	if(pixelStart < 0 || fileEnd < pixelStart || pixelBytes > fileEnd - pixelStart)
+		return 0;
+	in.seekg(pixelStart + pixelBytes);
+
+	Mask loaded;
+	if(hasMask)
+	{
+		// Each outline takes at least one count, and each point two coordinates,
+		// so these bounds keep a corrupt count from allocating too much memory.
+		uint32_t outlines = 0;
+		if(!ReadValue(in, outlines) || outlines > (fileEnd - in.tellg()) / sizeof(uint32_t))
+			return 0;
+		loaded.outlines.resize(outlines);
+		for(vector<Point> &outline : loaded.outlines)
+		{
+			uint32_t points = 0;
+			if(!ReadValue(in, points) || points > (fileEnd - in.tellg()) / (2 * sizeof(double)))
+				return 0;
+			outline.reserve(points);
+			for(uint32_t i = 0; i < points; ++i)
+			{
+				double x = 0.;
+				double y = 0.;
+				if(!ReadValue(in, x) || !ReadValue(in, y))
+					return 0;
+				outline.emplace_back(x, y);
+			}
+		}
+		if(!ReadValue(in, loaded.radius))
+			return 0;
+	}
+	if(in.tellg() != fileEnd)
+		return 0;
+
+	// The entry is valid, so the pixels can be read straight into the buffer,
+	// with no decoding needed.
+	if(!isAllocated)
+	{
+		if(frames > 1)
+			buffer.Clear(frames);
+		buffer.Allocate(width, height);
+	}
+	in.seekg(pixelStart);
+	if(!in.read(reinterpret_cast<char *>(buffer.Begin(0, frame)), pixelBytes))
+		return 0;
+
+	if(mask)
+		*mask = std::move(loaded);
+
+	return frames;
+}
+
+
+
+void ImageCache::Write(const filesystem::path &path, const ImageBuffer &buffer, int frame, int frames,
+	const Mask *mask)
+{
+	Source source;
+	if(!enabled || !buffer.Pixels() || frames <= 0 || frame + frames > buffer.Frames() || !GetSource(path, source))
+		return;
+
+	// Write to a temporary file first, so that an interrupted write can never
+	// leave behind an entry that looks valid.
+	const filesystem::path entryPath = EntryPath(source);
+	filesystem::path tempPath = entryPath;
+	tempPath += "." + to_string(hash<thread::id>{}(this_thread::get_id())) + ".tmp";
+	{
+		ofstream out(tempPath, ios::out | ios::binary | ios::trunc);
+		if(!out)
+			return;
+
+		out.write(MAGIC, sizeof(MAGIC));
+		WriteValue(out, VERSION);
+		WriteValue(out, source.size);
+		WriteValue(out, source.time);
+		WriteValue(out, static_cast<uint32_t>(source.path.size()));
+		out.write(source.path.data(), source.path.size());
+
+		WriteValue(out, static_cast<int32_t>(buffer.Width()));
+		WriteValue(out, static_cast<int32_t>(buffer.Height()));
+		WriteValue(out, static_cast<int32_t>(frames));
+		WriteValue(out, static_cast<uint8_t>(mask != nullptr));
+		out.write(reinterpret_cast<const char *>(buffer.Begin(0, frame)),
+			static_cast<streamsize>(buffer.Width()) * buffer.Height() * frames * sizeof(uint32_t));
+
+		if(mask)
+		{
+			WriteValue(out, static_cast<uint32_t>(mask->outlines.size()));
+			for(const vector<Point> &outline : mask->outlines)
+			{
+				WriteValue(out, static_cast<uint32_t>(outline.size()));
+				for(const Point &point : outline)
+				{
+					WriteValue(out, point.X());
+					WriteValue(out, point.Y());
+				}
+			}
+			WriteValue(out, mask->radius);
+		}
+		if(!out)
+		{
+			out.close();
+			error_code error;
+			filesystem::remove(tempPath, error);
+			return;
+		}
+	}
+
+	// Replace any previous entry for this file.
+	error_code error;
+	filesystem::rename(tempPath, entryPath, error);
+	if(error)
+	{
+		filesystem::remove(entryPath, error);
+		filesystem::rename(tempPath, entryPath, error);
+		if(error)
+			filesystem::remove(tempPath, error);
+	}
+}
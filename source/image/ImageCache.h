@@ -0,0 +1,48 @@
+/* ImageCache.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <filesystem>
+
+class ImageBuffer;
+class Mask;
+
+
+
+// An optional cache of decoded images, stored in the user's configuration
+// directory so that the images do not need to be decoded again on the next
+// launch. Each entry holds the frames read from one image file, after they
+// have been converted to premultiplied alpha, along with the collision mask
+// generated from that file if there is one. An entry is only used if the image
+// file still has the same size and modification time as when it was cached;
+// otherwise the image is decoded again and the entry is replaced.
+class ImageCache {
+public:
+	// Enable the cache, creating its directory if necessary. Until this is
+	// called, reading from the cache always fails and nothing is written.
+	static void Enable();
+	static bool IsEnabled();
+
+	// Read the cached frames of the given image file into the buffer, starting
+	// at the given frame, as ImageBuffer::Read() would. If a mask is given, it
+	// is also loaded, and the entry is only used if it includes a mask. Returns
+	// the number of frames read, or 0 if there is no up-to-date entry.
+	static int Read(const std::filesystem::path &path, ImageBuffer &buffer, int frame, Mask *mask = nullptr);
+	// Store the given frames of the buffer, which were read from the given
+	// image file, and optionally the mask generated from them.
+	static void Write(const std::filesystem::path &path, const ImageBuffer &buffer, int frame, int frames,
+		const Mask *mask = nullptr);
+};
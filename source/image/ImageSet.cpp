@@ -18,6 +18,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "../text/Format.h"
 #include "../GameData.h"
 #include "ImageBuffer.h"
+#include "ImageCache.h"
 #include "../Logger.h"
 #include "Mask.h"
 #include "MaskManager.h"
@@ -220,7 +221,12 @@ void ImageSet::Load() noexcept(false)
 	// to be in separate locations on the disk. Create masks if needed.
 	for(size_t i = 0; i < paths[0].size(); ++i)
 	{
-		int loadedFrames = buffer[0].Read(paths[0][i], i);
+		// A cached copy of the image includes its collision mask, if it needs one.
+		Mask cachedMask;
+		int loadedFrames = ImageCache::Read(paths[0][i], buffer[0], i, makeMasks ? &cachedMask : nullptr);
+		const bool isCached = loadedFrames;
+		if(!isCached)
+			loadedFrames = buffer[0].Read(paths[0][i], i);
 		const string fileName = "\"" + name + "\" frame #" + to_string(i);
 		if(!loadedFrames)
 		{
@@ -236,22 +242,34 @@ void ImageSet::Load() noexcept(false)
 
 		if(makeMasks)
 		{
-			masks[i].Create(buffer[0], i, fileName);
+			if(isCached)
+				masks[i] = std::move(cachedMask);
+			else
+				masks[i].Create(buffer[0], i, fileName);
 			if(!masks[i].IsLoaded())
 				Logger::Log("Failed to create collision mask for " + fileName, Logger::Level::WARNING);
 		}
+		if(!isCached)
+			ImageCache::Write(paths[0][i], buffer[0], i, loadedFrames, makeMasks ? &masks[i] : nullptr);
 	}
 
 	auto LoadSprites = [&](const vector<filesystem::path> &toLoad, ImageBuffer &buffer, const string &specifier)
 	{
 		for(size_t i = 0; i < frames && i < toLoad.size(); ++i)
-			if(!buffer.Read(toLoad[i], i))
+		{
+			if(ImageCache::Read(toLoad[i], buffer, i))
+				continue;
+			const int loadedFrames = buffer.Read(toLoad[i], i);
+			if(loadedFrames)
+				ImageCache::Write(toLoad[i], buffer, i, loadedFrames);
+			else
 			{
 				Logger::Log("Removing " + specifier + " frames for \"" + name + "\" due to read error",
 					Logger::Level::WARNING);
 				buffer.Clear();
 				break;
 			}
+		}
 	};
 	// Now, load the mask and 2x sprites, if they exist. Because the number of 1x frames
 	// is definitive, don't load any frames beyond the size of the 1x list.
@@ -74,4 +74,7 @@ private:
 private:
 	std::vector<std::vector<Point>> outlines;
 	double radius = 0.;
+
+	// Allow the image cache to store and restore masks.
+	friend class ImageCache;
 };
@@ -16,6 +16,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "audio/Audio.h"
+#include "Benchmark.h"
+#include "Color.h"
 #include "Command.h"
 #include "Conversation.h"
 #include "CustomEvents.h"
@@ -23,6 +25,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "DataNode.h"
 #include "Engine.h"
 #include "Files.h"
+#include "shader/FillShader.h"
 #include "text/Font.h"
 #include "text/FontSet.h"
 #include "text/Format.h"
@@ -31,6 +34,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "GameLoadingPanel.h"
 #include "GameVersion.h"
 #include "GameWindow.h"
+#include "image/ImageCache.h"
 #include "Interface.h"
 #include "Logger.h"
 #include "MainPanel.h"
@@ -38,8 +42,10 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "Panel.h"
 #include "PlayerInfo.h"
 #include "Plugins.h"
+#include "Point.h"
 #include "Preferences.h"
 #include "PrintData.h"
+#include "Profiler.h"
 #include "Screen.h"
 #include "image/SpriteSet.h"
 #include "shader/SpriteShader.h"
@@ -57,6 +63,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <chrono>
 #include <iostream>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include <cassert>
 #include <future>
@@ -88,6 +96,8 @@ void GameLoop(PlayerInfo &player, TaskQueue &queue, const Conversation &conversa
 	const string &testToRun, bool debugMode);
 Conversation LoadConversation(const PlayerInfo &player);
 void PrintTestsTable();
+void DrawProfile(const vector<pair<string, string>> &rows, double top);
+void WriteTrace(const string &path);
 
 
 
@@ -107,8 +117,11 @@ int main(int argc, char *argv[])
 	bool checkAssets = false;
 	bool printTests = false;
 	bool printData = false;
+	bool runBenchmark = false;
 	bool noTestMute = false;
+	bool useImageCache = false;
 	string testToRunName;
+	string tracePath;
 
 	// Whether the game has encountered errors while loading.
 	bool hasErrors = false;
@@ -146,15 +159,26 @@ int main(int argc, char *argv[])
 			printTests = true;
 		else if(arg == "--nomute")
 			noTestMute = true;
+		else if(arg == "--image-cache")
+			useImageCache = true;
+		else if(arg == "--trace" && *++it)
+			tracePath = *it;
 	}
 	printData = PrintData::IsPrintDataArgument(argv);
+	runBenchmark = Benchmark::IsBenchmarkArgument(argv);
 	Files::Init(argv);
+	if(useImageCache)
+		ImageCache::Enable();
+	// When writing a trace, record the whole session rather than just while the
+	// profile is shown.
+	if(!tracePath.empty())
+		Profiler::SetEnabled(true);
 
 	// Whether we are running an integration test.
 	const bool isTesting = !testToRunName.empty();
 	bool isConsoleOnly = loadOnly || printTests || printData;
 
-	Logger::Session logSession{isConsoleOnly || isTesting};
+	Logger::Session logSession{isConsoleOnly || isTesting || runBenchmark};
 
 	try {
 
@@ -165,11 +189,11 @@ int main(int argc, char *argv[])
 
 		// Begin loading the game data.
 		auto dataFuture = GameData::BeginLoad(queue, player, isConsoleOnly, debugMode,
-			isConsoleOnly || checkAssets || (isTesting && !debugMode));
+			isConsoleOnly || checkAssets || runBenchmark || (isTesting && !debugMode));
 
 		// If we are not using the UI, or performing some automated task, we should load
 		// all data now.
-		if(isConsoleOnly || checkAssets || isTesting)
+		if(isConsoleOnly || checkAssets || isTesting || runBenchmark)
 			dataFuture.wait();
 
 		if(isTesting && !GameData::Tests().Has(testToRunName))
@@ -188,6 +212,12 @@ int main(int argc, char *argv[])
 			PrintTestsTable();
 			return 0;
 		}
+		if(runBenchmark)
+		{
+			int result = Benchmark::Run(argv, player, queue);
+			WriteTrace(tracePath);
+			return result;
+		}
 
 		if(loadOnly || checkAssets)
 		{
@@ -255,6 +285,7 @@ int main(int argc, char *argv[])
 		CustomEvents::Init();
 		// This is the main loop where all the action begins.
 		GameLoop(player, queue, conversation, testToRunName, debugMode);
+		WriteTrace(tracePath);
 	}
 	catch(Test::known_failure_tag)
 	{
@@ -394,6 +425,11 @@ void GameLoop(PlayerInfo &player, TaskQueue &queue, const Conversation &conversa
 		chrono::steady_clock::duration gpuLoadSum{};
 		string gpuLoadString;
 		string memoryString;
+		string routesString;
+		// In debug mode, also show where the time of each frame went.
+		vector<pair<string, string>> profileRows;
+		chrono::steady_clock::time_point profileStart = chrono::steady_clock::now();
+		const bool isTracing = Profiler::IsEnabled();
 		bool isPerformanceDisplayReady = false;
 		int step = 0;
 		int drawStep = 0;
@@ -475,16 +511,24 @@ void GameLoop(PlayerInfo &player, TaskQueue &queue, const Conversation &conversa
 
 			gpuLoadSum += chrono::steady_clock::now() - drawStart;
 
-			if(Preferences::Has("Show CPU / GPU load"))
+			const bool showPerformance = Preferences::Has("Show CPU / GPU load");
+			Profiler::SetEnabled(isTracing || (debugMode && showPerformance));
+			if(showPerformance)
 			{
 				Information performanceInfo;
 				performanceInfo.SetString("cpu", cpuLoadString);
 				performanceInfo.SetString("gpu", gpuLoadString);
 				performanceInfo.SetString("mem", memoryString);
+				if(!routesString.empty())
+				{
+					performanceInfo.SetString("routes", routesString);
+					performanceInfo.SetCondition("routes");
+				}
 				if(isPerformanceDisplayReady)
 					performanceInfo.SetCondition("ready");
 				static const Interface &performanceDisplay = *GameData::Interfaces().Get("performance info");
 				performanceDisplay.Draw(performanceInfo);
+				DrawProfile(profileRows, routesString.empty() ? 55. : 69.);
 				if(drawStep == 60)
 				{
 					drawStep = 0;
@@ -520,6 +564,23 @@ void GameLoop(PlayerInfo &player, TaskQueue &queue, const Conversation &conversa
 #endif
 					// bytes / (1024 * 1024) = megabytes
 					memoryString = "MEM: " + Format::Number(virtualMemoryUse / 1048576., 2, false) + " MB";
+					// In debug mode, also show how often the AI could reuse a cached route.
+					routesString.clear();
+					if(debugMode && mainPanel)
+					{
+						const AI::RouteCacheCounters &routes = mainPanel->GetEngine().GetRouteCacheCounters();
+						const uint64_t lookups = routes.hits + routes.misses;
+						if(lookups)
+							routesString = "Routes: " + Format::Percentage(static_cast<double>(routes.hits) / lookups, 0)
+								+ " hit, " + Format::Number(static_cast<int64_t>(routes.evictions)) + " evicted";
+					}
+					// The profiled times are also averaged over the last 60 drawn frames.
+					profileRows.clear();
+					if(debugMode)
+						for(const Profiler::Summary &summary : Profiler::Summarize(profileStart))
+							profileRows.emplace_back(summary.name,
+								Format::Number(summary.time.count() / 6e7, 2, false) + " ms");
+					profileStart = chrono::steady_clock::now();
 					isPerformanceDisplayReady = true;
 				}
 			}
@@ -529,6 +590,8 @@ void GameLoop(PlayerInfo &player, TaskQueue &queue, const Conversation &conversa
 				drawStep = 0;
 				cpuLoadSum = {};
 				gpuLoadSum = {};
+				profileRows.clear();
+				profileStart = chrono::steady_clock::now();
 				isPerformanceDisplayReady = false;
 			}
 
@@ -619,10 +682,15 @@ void PrintHelp()
 	cerr << "    -p, --parse-save: load the most recent saved game and inspect it for content errors." << endl;
 	cerr << "    --parse-assets: load all game data, images, and sounds,"
 		" and the latest save game, and inspect data for errors." << endl;
+	cerr << "    --image-cache: keep decoded images in the config directory to speed up later launches."
+		" Combine with --parse-assets to fill the cache without starting the game." << endl;
 	cerr << "    --tests: print table of available tests, then exit." << endl;
 	cerr << "    --test <name>: run given test from resources directory." << endl;
 	cerr << "    --nomute: don't mute the game while running tests." << endl;
+	cerr << "    --trace <path>: record where the time of each frame goes, and write the last few seconds"
+		" of it to the given file on exit, in Chrome's trace event format." << endl;
 	PrintData::Help();
+	Benchmark::Help();
 	cerr << endl;
 	cerr << "Report bugs to: <https://github.com/endless-sky/endless-sky/issues>" << endl;
 	cerr << "Home page: <https://endless-sky.github.io>" << endl;
@@ -692,3 +760,42 @@ void PrintTestsTable()
 			cout << it.second.Name() << '\n';
 	cout.flush();
 }
+
+
+
+// Draw the profiled times below the performance display, with the name of
+// each scope on the left and its time on the right.
+void DrawProfile(const vector<pair<string, string>> &rows, double top)
+{
+	if(rows.empty())
+		return;
+
+	const Font &font = FontSet::Get(14);
+	const Color &background = *GameData::Colors().Get("performance info background");
+	const Color &color = *GameData::Colors().Get("medium");
+	const double width = 240.;
+	const double height = 14. * rows.size() + 6.;
+	const Point corner = Screen::TopLeft() + Point(560., top);
+	FillShader::Fill(corner + .5 * Point(width, height), Point(width, height), background);
+
+	Point point = corner + Point(10., 3.);
+	for(const auto &[name, time] : rows)
+	{
+		font.Draw(name, point, color);
+		font.Draw(time, point + Point(width - 20. - font.Width(time), 0.), color);
+		point.Y() += 14.;
+	}
+}
+
+
+
+// Write the profiler's records to the given file, if one was given on the command line.
+void WriteTrace(const string &path)
+{
+	if(path.empty())
+		return;
+	if(Profiler::WriteTrace(path))
+		cout << "Wrote the trace to \"" << path << "\"." << endl;
+	else
+		Logger::Log("Unable to write the trace to \"" + path + "\".", Logger::Level::ERROR);
+}
@@ -84,3 +84,15 @@ bool OpenGL::HasClearBufferSupport()
 {
 	return hasOpenGL3Support;
 }
+
+
+
+bool OpenGL::HasInstancingSupport()
+{
+	// Instanced vertex attributes are part of OpenGL 3.3 and OpenGL ES 3.0.
+#if defined(__APPLE__) || defined(ES_GLES)
+	return hasOpenGL3Support;
+#else
+	return hasOpenGL3Support && GLEW_VERSION_3_3;
+#endif
+}
@@ -39,4 +39,5 @@ public:
 	static bool HasVaoSupport();
 	static bool HasTexture2DArraySupport();
 	static bool HasClearBufferSupport();
+	static bool HasInstancingSupport();
 };
@@ -41,7 +41,9 @@ namespace {
 // Clear the list, also setting the global time step for animation.
 void BatchDrawList::Clear(int step, double zoom)
 {
-	data.clear();
+	// Keep the buckets and their storage, so that it can be reused.
+	for(Bucket &bucket : buckets)
+		bucket.vertices.clear();
 	this->step = step;
 	this->zoom = zoom;
 }
@@ -86,8 +88,8 @@ void BatchDrawList::Draw() const
 {
 	BatchShader::Bind();
 
-	for(const pair<const Sprite * const, vector<float>> &it : data)
-		BatchShader::Add(it.first, it.second);
+	for(const Bucket &bucket : buckets)
+		BatchShader::Add(bucket.sprite, bucket.vertices);
 
 	BatchShader::Unbind();
 }
@@ -123,7 +125,7 @@ bool BatchDrawList::Add(const Body &body, Point position, float clip)
 		return false;
 
 	// Get the data vector for this particular sprite.
-	vector<float> &v = data[body.GetSprite()];
+	vector<float> &v = Vertices(body.GetSprite());
 	// The sprite frame is the same for every vertex.
 	float frame = body.GetFrame(step);
 
@@ -156,3 +158,20 @@ bool BatchDrawList::Add(const Body &body, Point position, float clip)
 
 	return true;
 }
+
+
+
+vector<float> &BatchDrawList::Vertices(const Sprite *sprite)
+{
+	if(lastBucket < buckets.size() && buckets[lastBucket].sprite == sprite)
+		return buckets[lastBucket].vertices;
+
+	auto it = bucketIndex.find(sprite);
+	if(it == bucketIndex.end())
+	{
+		it = bucketIndex.emplace(sprite, buckets.size()).first;
+		buckets.push_back(Bucket{sprite, {}});
+	}
+	lastBucket = it->second;
+	return buckets[lastBucket].vertices;
+}
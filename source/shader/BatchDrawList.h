@@ -17,7 +17,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include "../Point.h"
 
-#include <map>
+#include <cstddef>
+#include <unordered_map>
 #include <vector>
 
 class Body;
@@ -27,6 +28,8 @@ class Sprite;
 
 // This class collects a set of OpenGL draw commands to issue and groups them by
 // sprite, so all instances of each sprite can be drawn with a single command.
+// The storage for each sprite is kept when the list is cleared, so once a list
+// has been filled with a typical frame, filling it again needs no allocations.
 class BatchDrawList {
 public:
 	// Clear the list, also setting the global time step for animation.
@@ -48,6 +51,10 @@ private:
 	// Add the given body at the given position.
 	bool Add(const Body &body, Point position, float clip);
 
+	// Get the vertex data for the given sprite, which is empty if no instances
+	// of it have been added since the list was last cleared.
+	std::vector<float> &Vertices(const Sprite *sprite);
+
 
 private:
 	int step = 0;
@@ -58,5 +65,15 @@ private:
 	// two dummy vertices to mark the break in between them). Each of those
 	// vertices has six attributes: (x, y) position in pixels, (s, t) texture
 	// coordinates, the index of the sprite frame, and the alpha value.
-	std::map<const Sprite *, std::vector<float>> data;
+	// The sprites are stored in the order they were first drawn in.
+	struct Bucket {
+		const Sprite *sprite;
+		std::vector<float> vertices;
+	};
+	std::vector<Bucket> buckets;
+	// The index of each sprite's bucket.
+	std::unordered_map<const Sprite *, size_t> bucketIndex;
+	// The bucket that was used last, since instances of the same sprite are
+	// often added one after another.
+	size_t lastBucket = 0;
 };
@@ -31,6 +31,8 @@ using namespace std;
 void DrawList::Clear(int step, double zoom)
 {
 	items.clear();
+	instances.clear();
+	batches.clear();
 	this->step = step;
 	this->zoom = zoom;
 }
@@ -95,9 +97,24 @@ bool DrawList::AddSwizzled(const Body &body, const Swizzle *swizzle, double cloa
 // Draw all the items in this list.
 void DrawList::Draw() const
 {
+	bool withBlur = Preferences::Has("Render motion blur");
+	if(!batches.empty())
+	{
+		SpriteShader::BindInstanced(instances, withBlur);
+
+		size_t first = 0;
+		for(size_t count : batches)
+		{
+			SpriteShader::AddInstanced(items[first], first, count);
+			first += count;
+		}
+
+		SpriteShader::UnbindInstanced();
+		return;
+	}
+
 	SpriteShader::Bind();
 
-	bool withBlur = Preferences::Has("Render motion blur");
 	for(const SpriteShader::Item &item : items)
 		SpriteShader::Add(item, withBlur);
 
@@ -166,5 +183,13 @@ void DrawList::Push(const Body &body, Point pos, Point blur, double cloak, const
 	item.swizzle = swizzle;
 	item.clip = 1.;
 
+	if(SpriteShader::UseInstancing())
+	{
+		SpriteShader::PackInstance(item, instances);
+		if(!items.empty() && SpriteShader::CanBatch(items.back(), item))
+			++batches.back();
+		else
+			batches.push_back(1);
+	}
 	items.push_back(item);
 }
@@ -18,6 +18,7 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "../Point.h"
 #include "SpriteShader.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -31,7 +32,9 @@ class Swizzle;
 // work of calculating the transformation matrices to be done in a separate
 // thread from the graphics thread. However, the SpriteShader class is also
 // available for drawing individual sprites in contexts where putting them into
-// a DrawList first does not make sense.
+// a DrawList first does not make sense. If instancing is available, the
+// per-instance data for the items is also prepared in the other thread, so
+// that each run of items using the same sprite can be drawn in a single call.
 class DrawList {
 public:
 	// Clear the list, also setting the global time step for animation.
@@ -63,6 +66,11 @@ private:
 	int step = 0;
 	double zoom = 1.;
 	std::vector<SpriteShader::Item> items;
+	// The per-instance data of every item, and the number of items in each run
+	// of consecutive items that can be drawn in the same call. Runs are never
+	// merged out of order, so the items overlap just as if drawn one by one.
+	std::vector<float> instances;
+	std::vector<size_t> batches;
 
 	Point center;
 	Point centerVelocity;
@@ -45,11 +45,79 @@ namespace {
 	GLuint vao;
 	GLuint vbo;
 
+	// The shader used for drawing many items at once, if instancing is supported.
+	bool useInstancing = false;
+	const Shader *instancedShader;
+	GLint instancedScaleI;
+	GLint instancedFrameCountI;
+	GLint instancedUniqueSwizzleMaskFramesI;
+	GLint instancedSwizzleMatrixI;
+	GLint instancedUseSwizzleI;
+	GLint instancedUseSwizzleMaskI;
+	GLint instancedUseBlurI;
+
+	GLint instancedVertI;
+	GLint instancePositionI;
+	GLint instanceTransformI;
+	GLint instanceBlurI;
+	GLint instanceClipI;
+	GLint instanceAlphaI;
+	GLint instanceFrameI;
+
+	GLuint instancedVao;
+	GLuint instanceVbo;
+
+	// The number of floats per instance: position (2), transform (4), blur (2),
+	// clip, alpha, and frame.
+	constexpr size_t INSTANCE_FLOATS = 11;
+
 	void EnableAttribArrays()
 	{
 		glEnableVertexAttribArray(vertI);
 		glVertexAttribPointer(vertI, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
 	}
+
+	// Point the per-instance attributes at the data for the given instance,
+	// which must be in the currently bound buffer.
+	void PointInstanceAttribs(size_t firstInstance)
+	{
+		constexpr auto stride = INSTANCE_FLOATS * sizeof(GLfloat);
+		const size_t offset = firstInstance * stride;
+		const auto Pointer = [offset](size_t index)
+		{
+			return reinterpret_cast<const GLvoid *>(offset + index * sizeof(GLfloat));
+		};
+		glVertexAttribPointer(instancePositionI, 2, GL_FLOAT, GL_FALSE, stride, Pointer(0));
+		glVertexAttribPointer(instanceTransformI, 4, GL_FLOAT, GL_FALSE, stride, Pointer(2));
+		glVertexAttribPointer(instanceBlurI, 2, GL_FLOAT, GL_FALSE, stride, Pointer(6));
+		glVertexAttribPointer(instanceClipI, 1, GL_FLOAT, GL_FALSE, stride, Pointer(8));
+		glVertexAttribPointer(instanceAlphaI, 1, GL_FLOAT, GL_FALSE, stride, Pointer(9));
+		glVertexAttribPointer(instanceFrameI, 1, GL_FLOAT, GL_FALSE, stride, Pointer(10));
+	}
+
+	// Set the swizzle and textures that are shared by all instances drawn at once.
+	void BindInstancedItem(const SpriteShader::Item &item)
+	{
+		if(item.swizzle)
+		{
+			// Don't mask full color swizzles that always apply to the whole ship sprite.
+			glUniform1i(instancedUseSwizzleMaskI, item.swizzle->OverrideMask() ? 0 : item.swizzleMask);
+			glUniformMatrix4fv(instancedSwizzleMatrixI, 1, GL_FALSE, item.swizzle->MatrixPtr());
+			glUniform1i(instancedUseSwizzleI, !item.swizzle->IsIdentity());
+		}
+		else
+			glUniform1i(instancedUseSwizzleI, 0);
+
+		int type = OpenGL::HasTexture2DArraySupport() ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_3D;
+		glBindTexture(type, item.texture);
+
+		glActiveTexture(GL_TEXTURE1);
+		glBindTexture(type, item.swizzleMask);
+		glActiveTexture(GL_TEXTURE0);
+
+		glUniform1f(instancedFrameCountI, item.frameCount);
+		glUniform1i(instancedUniqueSwizzleMaskFramesI, item.uniqueSwizzleMaskFrames);
+	}
 }
 
 // Initialize the shaders.
@@ -99,6 +167,58 @@ void SpriteShader::Init()
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	if(OpenGL::HasVaoSupport())
 		glBindVertexArray(0);
+
+	// Set up the instanced shader. It needs a VAO, and without instancing
+	// support every item is drawn with its own call instead.
+	useInstancing = OpenGL::HasInstancingSupport() && OpenGL::HasVaoSupport();
+	if(!useInstancing)
+		return;
+
+	instancedShader = GameData::Shaders().Get("spriteInstanced");
+	if(!instancedShader->Object())
+		throw runtime_error("Could not find instanced sprite shader!");
+	instancedScaleI = instancedShader->Uniform("scale");
+	instancedFrameCountI = instancedShader->Uniform("frameCount");
+	instancedUniqueSwizzleMaskFramesI = instancedShader->Uniform("uniqueSwizzleMaskFrames");
+	instancedSwizzleMatrixI = instancedShader->Uniform("swizzleMatrix");
+	instancedUseSwizzleI = instancedShader->Uniform("useSwizzle");
+	instancedUseSwizzleMaskI = instancedShader->Uniform("useSwizzleMask");
+	instancedUseBlurI = instancedShader->Uniform("useBlur");
+	instancedVertI = instancedShader->Attrib("vert");
+	instancePositionI = instancedShader->Attrib("position");
+	instanceTransformI = instancedShader->Attrib("transform");
+	instanceBlurI = instancedShader->Attrib("blur");
+	instanceClipI = instancedShader->Attrib("clip");
+	instanceAlphaI = instancedShader->Attrib("alpha");
+	instanceFrameI = instancedShader->Attrib("frame");
+
+	// The sprite and its swizzle mask use textures 0 and 1.
+	glUseProgram(instancedShader->Object());
+	glUniform1i(instancedShader->Uniform("tex"), 0);
+	glUniform1i(instancedShader->Uniform("swizzleMask"), 1);
+	glUseProgram(0);
+
+	glGenVertexArrays(1, &instancedVao);
+	glBindVertexArray(instancedVao);
+
+	// The corners of the quad are shared by all instances.
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glEnableVertexAttribArray(instancedVertI);
+	glVertexAttribPointer(instancedVertI, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
+
+	// Everything else advances once per instance.
+	glGenBuffers(1, &instanceVbo);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+	for(GLint attrib : {instancePositionI, instanceTransformI, instanceBlurI,
+			instanceClipI, instanceAlphaI, instanceFrameI})
+	{
+		glEnableVertexAttribArray(attrib);
+		glVertexAttribDivisor(attrib, 1);
+	}
+	PointInstanceAttribs(0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
 }
 
 
@@ -217,3 +337,65 @@ void SpriteShader::Unbind()
 	}
 	glUseProgram(0);
 }
+
+
+
+bool SpriteShader::UseInstancing()
+{
+	return useInstancing;
+}
+
+
+
+bool SpriteShader::CanBatch(const Item &first, const Item &second)
+{
+	return first.texture == second.texture && first.swizzleMask == second.swizzleMask
+		&& first.swizzle == second.swizzle;
+}
+
+
+
+void SpriteShader::PackInstance(const Item &item, vector<float> &instances)
+{
+	instances.insert(instances.end(), {
+		item.position[0], item.position[1],
+		item.transform[0], item.transform[1], item.transform[2], item.transform[3],
+		item.blur[0], item.blur[1],
+		item.clip, item.alpha, item.frame});
+}
+
+
+
+void SpriteShader::BindInstanced(const vector<float> &instances, bool withBlur)
+{
+	glUseProgram(instancedShader->Object());
+	glBindVertexArray(instancedVao);
+
+	// Upload the data for every instance that will be drawn.
+	glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(float) * instances.size(), instances.data(), GL_STREAM_DRAW);
+
+	GLfloat scale[2] = {2.f / Screen::Width(), -2.f / Screen::Height()};
+	glUniform2fv(instancedScaleI, 1, scale);
+	glUniform1i(instancedUseBlurI, withBlur);
+}
+
+
+
+void SpriteShader::AddInstanced(const Item &item, size_t firstInstance, size_t count)
+{
+	BindInstancedItem(item);
+	PointInstanceAttribs(firstInstance);
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+}
+
+
+
+void SpriteShader::UnbindInstanced()
+{
+	glUniform1i(instancedUseSwizzleI, 0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+	glUseProgram(0);
+}
@@ -18,7 +18,9 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include "../Point.h"
 #include "../Swizzle.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 class Sprite;
 
@@ -60,4 +62,20 @@ public:
 	static void Bind();
 	static void Add(const Item &item, bool withBlur = false);
 	static void Unbind();
+
+	// Check whether items can be drawn with instancing, which requires a
+	// context that supports instanced vertex attributes.
+	static bool UseInstancing();
+	// Check whether two items can be drawn in the same instanced draw call.
+	static bool CanBatch(const Item &first, const Item &second);
+	// Append the values that differ between items drawn in the same call to
+	// the given per-instance data.
+	static void PackInstance(const Item &item, std::vector<float> &instances);
+
+	// Draw items using instancing. All the per-instance data for the frame is
+	// uploaded at once, then each run of items that CanBatch() is drawn with a
+	// single call, using the shared values of the first item in the run.
+	static void BindInstanced(const std::vector<float> &instances, bool withBlur = false);
+	static void AddInstanced(const Item &item, size_t firstInstance, size_t count);
+	static void UnbindInstanced();
 };
@@ -0,0 +1,67 @@
+/* ShipDerivedStats.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ShipDerivedStats.h"
+
+#include "../Attribute.h"
+#include "../Outfit.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+
+
+void ShipDerivedStats::Calibrate(const Outfit &attributes)
+{
+	maxShields = attributes.Get(Attribute::SHIELDS) * (1 + attributes.Get(Attribute::SHIELD_MULTIPLIER));
+	maxHull = attributes.Get(Attribute::HULL) * (1 + attributes.Get(Attribute::HULL_MULTIPLIER));
+
+	double absoluteThreshold = attributes.Get(Attribute::ABSOLUTE_THRESHOLD);
+	if(absoluteThreshold > 0.)
+		minimumHull = absoluteThreshold;
+	else
+	{
+		double thresholdPercent = attributes.Get(Attribute::THRESHOLD_PERCENTAGE);
+		double transition = 1 / (1 + 0.0005 * maxHull);
+		double threshold = maxHull * (thresholdPercent > 0.
+			? min(thresholdPercent, 1.) : 0.1 * (1. - transition) + 0.5 * transition);
+		minimumHull = max(0., floor(threshold + attributes.Get(Attribute::HULL_THRESHOLD)));
+	}
+
+	heatDissipation = .001 * attributes.Get(Attribute::HEAT_DISSIPATION);
+	heatCapacity = attributes.Get(Attribute::HEAT_CAPACITY);
+	// This is an S-curve where the efficiency is 100% if you have no outfits
+	// that create "cooling inefficiency", and as that value increases the
+	// efficiency stays high for a while, then drops off, then approaches 0.
+	double x = attributes.Get(Attribute::COOLING_INEFFICIENCY);
+	coolingEfficiency = 2. + 2. / (1. + exp(x / -2.)) - 4. / (1. + exp(x / -4.));
+
+	cloak = attributes.Get(Attribute::CLOAK);
+	cloakByMass = attributes.Get(Attribute::CLOAK_BY_MASS);
+
+	drag = attributes.Get(Attribute::DRAG) / (1. + attributes.Get(Attribute::DRAG_REDUCTION));
+	inertiaDivisor = 1. + attributes.Get(Attribute::INERTIA_REDUCTION);
+	turn = attributes.Get(Attribute::TURN);
+	turnMultiplier = 1. + attributes.Get(Attribute::TURN_MULTIPLIER);
+	thrust = attributes.Get(Attribute::THRUST);
+	afterburnerThrust = attributes.Get(Attribute::AFTERBURNER_THRUST);
+	reverseThrust = attributes.Get(Attribute::REVERSE_THRUST);
+	accelerationMultiplier = 1. + attributes.Get(Attribute::ACCELERATION_MULTIPLIER);
+
+	// Drones do not need crew, but all other ships need at least one.
+	requiredCrew = attributes.Get(Attribute::AUTOMATON) ? 0 : max<int>(1, attributes.Get(Attribute::REQUIRED_CREW));
+}
@@ -0,0 +1,98 @@
+/* ShipDerivedStats.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class Outfit;
+
+
+
+// A class which caches the values a ship derives from its attributes, such as
+// its maximum shields or its drag. These only change when the ship's outfits
+// change, but are needed by the movement, generation and AI code every step,
+// so they are computed once here instead of being looked up every time.
+// Values that also depend on the ship's mass or cargo are left to the ship.
+class ShipDerivedStats {
+public:
+	ShipDerivedStats() = default;
+
+	// Recompute every value from the given (total) ship attributes.
+	void Calibrate(const Outfit &attributes);
+
+	// Accessors for the derived values.
+	double MaxShields() const;
+	double MaxHull() const;
+	// The hull below which the ship is disabled, ignoring "never disabled".
+	double MinimumHull() const;
+	double HeatDissipation() const;
+	double HeatCapacity() const;
+	double CoolingEfficiency() const;
+	double Cloak() const;
+	double CloakByMass() const;
+	// The drag after accounting for drag reduction, but not limited by mass.
+	double Drag() const;
+	// The mass is divided by this to get the inertial mass.
+	double InertiaDivisor() const;
+	double Turn() const;
+	double TurnMultiplier() const;
+	double Thrust() const;
+	double AfterburnerThrust() const;
+	double ReverseThrust() const;
+	double AccelerationMultiplier() const;
+	int RequiredCrew() const;
+
+
+private:
+	// The values are kept together so that reading several of them in the
+	// same step touches as few cache lines as possible.
+	double maxShields = 0.;
+	double maxHull = 0.;
+	double minimumHull = 0.;
+	double heatDissipation = 0.;
+	double heatCapacity = 0.;
+	double coolingEfficiency = 1.;
+	double cloak = 0.;
+	double cloakByMass = 0.;
+	double drag = 0.;
+	double inertiaDivisor = 1.;
+	double turn = 0.;
+	double turnMultiplier = 1.;
+	double thrust = 0.;
+	double afterburnerThrust = 0.;
+	double reverseThrust = 0.;
+	double accelerationMultiplier = 1.;
+	int requiredCrew = 1;
+};
+
+
+
+// Inline the accessors because they get called so frequently.
+inline double ShipDerivedStats::MaxShields() const { return maxShields; }
+inline double ShipDerivedStats::MaxHull() const { return maxHull; }
+inline double ShipDerivedStats::MinimumHull() const { return minimumHull; }
+inline double ShipDerivedStats::HeatDissipation() const { return heatDissipation; }
+inline double ShipDerivedStats::HeatCapacity() const { return heatCapacity; }
+inline double ShipDerivedStats::CoolingEfficiency() const { return coolingEfficiency; }
+inline double ShipDerivedStats::Cloak() const { return cloak; }
+inline double ShipDerivedStats::CloakByMass() const { return cloakByMass; }
+inline double ShipDerivedStats::Drag() const { return drag; }
+inline double ShipDerivedStats::InertiaDivisor() const { return inertiaDivisor; }
+inline double ShipDerivedStats::Turn() const { return turn; }
+inline double ShipDerivedStats::TurnMultiplier() const { return turnMultiplier; }
+inline double ShipDerivedStats::Thrust() const { return thrust; }
+inline double ShipDerivedStats::AfterburnerThrust() const { return afterburnerThrust; }
+inline double ShipDerivedStats::ReverseThrust() const { return reverseThrust; }
+inline double ShipDerivedStats::AccelerationMultiplier() const { return accelerationMultiplier; }
+inline int ShipDerivedStats::RequiredCrew() const { return requiredCrew; }
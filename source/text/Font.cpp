@@ -30,26 +30,27 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
 
 using namespace std;
 
 namespace {
 	bool showUnderlines = false;
 	const int KERN = 2;
+	// Once this many strings have been laid out, start the cache over, so that
+	// text that changes every frame does not make it grow without bound.
+	const size_t MAX_CACHED_LAYOUTS = 2000;
 
-	/// Shared VAO and VBO quad (0,0) -> (1,1)
+	/// Shared VAO and VBO for the vertices of the string being drawn.
 	GLuint vao = 0;
 	GLuint vbo = 0;
 
 	GLint colorI = 0;
 	GLint scaleI = 0;
-	GLint glyphSizeI = 0;
-	GLint glyphI = 0;
-	GLint aspectI = 0;
 	GLint positionI = 0;
 
 	GLint vertI;
-	GLint cornerI;
+	GLint glyphCoordI;
 
 	void EnableAttribArrays()
 	{
@@ -58,10 +59,26 @@ namespace {
 		glEnableVertexAttribArray(vertI);
 		glVertexAttribPointer(vertI, 2, GL_FLOAT, GL_FALSE, stride, nullptr);
 
-		glEnableVertexAttribArray(cornerI);
-		glVertexAttribPointer(cornerI, 2, GL_FLOAT, GL_FALSE,
+		glEnableVertexAttribArray(glyphCoordI);
+		glVertexAttribPointer(glyphCoordI, 2, GL_FLOAT, GL_FALSE,
 			stride, reinterpret_cast<const GLvoid *>(2 * sizeof(GLfloat)));
 	}
+
+	// Add the quad for one glyph to a triangle strip. Push two copies of the
+	// first and last vertices to mark the break between glyphs.
+	void PushGlyph(vector<float> &vertices, float x, float width, float height, float left, float right)
+	{
+		const float corners[4][4] = {
+			{x, 0.f, left, 0.f},
+			{x, height, left, 1.f},
+			{x + width, 0.f, right, 0.f},
+			{x + width, height, right, 1.f}
+		};
+		vertices.insert(vertices.end(), begin(corners[0]), end(corners[0]));
+		for(const auto &corner : corners)
+			vertices.insert(vertices.end(), begin(corner), end(corner));
+		vertices.insert(vertices.end(), begin(corners[3]), end(corners[3]));
+	}
 }
 
 
@@ -83,6 +100,7 @@ void Font::Load(const filesystem::path &imagePath)
 	LoadTexture(image);
 	CalculateAdvances(image);
 	SetUpShader(image.Width() / GLYPHS, image.Height());
+	layoutCache.clear();
 	widthEllipses = WidthRawString("...");
 }
 
@@ -121,15 +139,32 @@ void Font::Draw(const string &str, const Point &point, const Color &color) const
 
 void Font::DrawAliased(const string &str, double x, double y, const Color &color) const
 {
+	// Showing or hiding the underlines changes the layout of every string.
+	if(layoutCacheUnderlines != showUnderlines)
+	{
+		layoutCache.clear();
+		layoutCacheUnderlines = showUnderlines;
+	}
+	auto it = layoutCache.find(str);
+	if(it == layoutCache.end())
+	{
+		if(layoutCache.size() >= MAX_CACHED_LAYOUTS)
+			layoutCache.clear();
+		it = layoutCache.emplace(str, vector<float>()).first;
+		BuildVertices(str, it->second);
+	}
+	const vector<float> &vertices = it->second;
+	if(vertices.empty())
+		return;
+
 	glUseProgram(shader->Object());
 	glBindTexture(GL_TEXTURE_2D, texture);
 	if(OpenGL::HasVaoSupport())
 		glBindVertexArray(vao);
-	else
-	{
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	// Bind the vertex buffer so we can upload data to it.
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	if(!OpenGL::HasVaoSupport())
 		EnableAttribArrays();
-	}
 
 	glUniform4fv(colorI, 1, color.Get());
 
@@ -142,64 +177,20 @@ void Font::DrawAliased(const string &str, double x, double y, const Color &color
 		scale[1] = -2.f / screenHeight;
 	}
 	glUniform2fv(scaleI, 1, scale);
-	glUniform2f(glyphSizeI, glyphWidth, glyphHeight);
+	glUniform2f(positionI, static_cast<float>(x), static_cast<float>(y));
 
-	GLfloat textPos[2] = {
-		static_cast<float>(x - 1.),
-		static_cast<float>(y)};
-	int previous = 0;
-	bool isAfterSpace = true;
-	bool underlineChar = false;
-	const int underscoreGlyph = max(0, min(GLYPHS - 1, '_' - 32));
+	// Upload the glyphs and draw them all at once.
+	glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STREAM_DRAW);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, vertices.size() / 4);
 
-	for(char c : str)
+	if(!OpenGL::HasVaoSupport())
 	{
-		if(c == '_')
-		{
-			underlineChar = showUnderlines;
-			continue;
-		}
-
-		int glyph = Glyph(c, isAfterSpace);
-		if(c != '"' && c != '\'')
-			isAfterSpace = !glyph;
-		if(!glyph)
-		{
-			textPos[0] += space;
-			continue;
-		}
-
-		glUniform1i(glyphI, glyph);
-		glUniform1f(aspectI, 1.f);
-
-		textPos[0] += advance[previous * GLYPHS + glyph] + KERN;
-		glUniform2fv(positionI, 1, textPos);
-
-		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-
-		if(underlineChar)
-		{
-			glUniform1i(glyphI, underscoreGlyph);
-			glUniform1f(aspectI, static_cast<float>(advance[glyph * GLYPHS] + KERN)
-				/ (advance[underscoreGlyph * GLYPHS] + KERN));
-
-			glUniform2fv(positionI, 1, textPos);
-
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-			underlineChar = false;
-		}
-
-		previous = glyph;
+		glDisableVertexAttribArray(vertI);
+		glDisableVertexAttribArray(glyphCoordI);
 	}
-
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	if(OpenGL::HasVaoSupport())
 		glBindVertexArray(0);
-	else
-	{
-		glDisableVertexAttribArray(vertI);
-		glDisableVertexAttribArray(cornerI);
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	}
 	glUseProgram(0);
 }
 
@@ -242,6 +233,55 @@ void Font::ShowUnderlines(bool show) noexcept
 
 
 
+void Font::BuildVertices(const string &str, vector<float> &vertices) const
+{
+	vertices.clear();
+	// Each glyph, and each underline, takes six vertices of four floats each.
+	vertices.reserve(str.size() * 24);
+
+	float textX = -1.f;
+	int previous = 0;
+	bool isAfterSpace = true;
+	bool underlineChar = false;
+	const int underscoreGlyph = max(0, min(GLYPHS - 1, '_' - 32));
+
+	for(char c : str)
+	{
+		if(c == '_')
+		{
+			underlineChar = showUnderlines;
+			continue;
+		}
+
+		int glyph = Glyph(c, isAfterSpace);
+		if(c != '"' && c != '\'')
+			isAfterSpace = !glyph;
+		if(!glyph)
+		{
+			textX += space;
+			continue;
+		}
+
+		textX += advance[previous * GLYPHS + glyph] + KERN;
+		PushGlyph(vertices, textX, glyphWidth, glyphHeight,
+			static_cast<float>(glyph) / GLYPHS, static_cast<float>(glyph + 1) / GLYPHS);
+
+		if(underlineChar)
+		{
+			// Stretch the underscore to the width of the underlined glyph.
+			const float aspect = static_cast<float>(advance[glyph * GLYPHS] + KERN)
+				/ (advance[underscoreGlyph * GLYPHS] + KERN);
+			PushGlyph(vertices, textX, aspect * glyphWidth, glyphHeight,
+				static_cast<float>(underscoreGlyph) / GLYPHS, static_cast<float>(underscoreGlyph + 1) / GLYPHS);
+			underlineChar = false;
+		}
+
+		previous = glyph;
+	}
+}
+
+
+
 int Font::Glyph(char c, bool isAfterSpace) noexcept
 {
 	// Curly quotes.
@@ -343,7 +383,7 @@ void Font::SetUpShader(float glyphW, float glyphH)
 	if(!vbo)
 	{
 		vertI = shader->Attrib("vert");
-		cornerI = shader->Attrib("corner");
+		glyphCoordI = shader->Attrib("glyphCoord");
 
 		glUseProgram(shader->Object());
 		glUniform1i(shader->Uniform("tex"), 0);
@@ -359,14 +399,6 @@ void Font::SetUpShader(float glyphW, float glyphH)
 		glGenBuffers(1, &vbo);
 		glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
-		GLfloat vertices[] = {
-				0.f, 0.f, 0.f, 0.f,
-				0.f, 1.f, 0.f, 1.f,
-				1.f, 0.f, 1.f, 0.f,
-				1.f, 1.f, 1.f, 1.f
-		};
-		glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
 		if(OpenGL::HasVaoSupport())
 			EnableAttribArrays();
 
@@ -376,9 +408,6 @@ void Font::SetUpShader(float glyphW, float glyphH)
 
 		colorI = shader->Uniform("color");
 		scaleI = shader->Uniform("scale");
-		glyphSizeI = shader->Uniform("glyphSize");
-		glyphI = shader->Uniform("glyph");
-		aspectI = shader->Uniform("aspect");
 		positionI = shader->Uniform("position");
 	}
 
@@ -22,6 +22,8 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 #include <filesystem>
 #include <functional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class Color;
 class DisplayText;
@@ -59,6 +61,12 @@ public:
 
 	static void ShowUnderlines(bool show) noexcept;
 
+	// Lay out the glyphs of the given string as a triangle strip, with four
+	// floats per vertex: its offset in pixels from where the string is drawn,
+	// and its texture coordinates. This is all the work done on the CPU to
+	// draw a string, which is then drawn with a single call.
+	void BuildVertices(const std::string &str, std::vector<float> &vertices) const;
+
 
 private:
 	static int Glyph(char c, bool isAfterSpace) noexcept;
@@ -77,7 +85,7 @@ private:
 		std::function<std::string(const std::string &, int)> getResultString) const;
 
 private:
-	const Shader *shader;
+	const Shader *shader = nullptr;
 	GLuint texture = 0;
 
 	int height = 0;
@@ -91,4 +99,10 @@ private:
 	static const int GLYPHS = 98;
 	int advance[GLYPHS * GLYPHS] = {};
 	int widthEllipses = 0;
+
+	// The vertices of recently drawn strings. Most text is drawn again every
+	// frame, and only the position of a string is needed to draw it again.
+	mutable std::unordered_map<std::string, std::vector<float>> layoutCache;
+	// Whether the cached strings were laid out with underlines shown.
+	mutable bool layoutCacheUnderlines = false;
 };
@@ -0,0 +1,31 @@
+/* allocation-counter.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+
+
+// Counts the calls to the global operator new made while it is alive, in any
+// thread, and the bytes they asked for. Only one counter should be alive at a time.
+class AllocationCounter {
+public:
+	AllocationCounter();
+	~AllocationCounter();
+
+	int Count() const;
+	std::size_t Bytes() const;
+};
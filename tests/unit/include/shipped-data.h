@@ -0,0 +1,41 @@
+/* shipped-data.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../../../source/DataNode.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+
+// Get the location of the game data shipped alongside the tests.
+const std::filesystem::path &ShippedDataPath();
+
+// Get all the root nodes with the given key in the game data shipped alongside
+// the tests, e.g. to test something with the real map instead of mock data.
+std::vector<DataNode> ShippedDataNodes(const std::string &key);
+
+// Load the systems in the shipped game data into the given set, and connect
+// them to their neighbors. This is meant for benchmarks; unit tests should
+// use a small map of their own.
+void LoadShippedSystems(Set<System> &systems);
+// Load the outfits in the shipped game data into GameData::Outfits(), where
+// ships loaded from the shipped game data look them up.
+void LoadShippedOutfits();
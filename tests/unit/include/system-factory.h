@@ -0,0 +1,30 @@
+/* system-factory.h
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../../../source/DataNode.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+
+#include <vector>
+
+
+
+// Load the system definitions in the given nodes into the given set, and connect
+// every system in it to its neighbors, as GameData does once the map is loaded.
+// Plain "link" nodes are made between the systems in the set, rather than the
+// ones in GameData that System::Load() would look them up in.
+void LoadSystems(Set<System> &systems, const std::vector<DataNode> &nodes);
@@ -0,0 +1,115 @@
+/* test_chunkQueue.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../../source/audio/supplier/ChunkQueue.h"
+
+// ... and any system includes needed for the test file.
+#include <thread>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+using Chunk = std::vector<AudioSupplier::sample_t>;
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Passing chunks through a queue", "[ChunkQueue]" ) {
+	GIVEN( "an empty queue" ) {
+		ChunkQueue queue(2, 4);
+		THEN( "it is empty" ) {
+			CHECK( queue.Size() == 0 );
+			CHECK_FALSE( queue.Full() );
+			Chunk chunk{1, 2};
+			CHECK_FALSE( queue.Pop(chunk) );
+			CHECK( chunk == Chunk{1, 2} );
+		}
+		WHEN( "chunks are pushed until it is full" ) {
+			Chunk first{1, 2, 3, 4};
+			Chunk second{5, 6, 7, 8};
+			Chunk third{9};
+			REQUIRE( queue.Push(first) );
+			REQUIRE( queue.Push(second) );
+			THEN( "no more chunks can be pushed" ) {
+				CHECK( queue.Full() );
+				CHECK( queue.Size() == 2 );
+				CHECK_FALSE( queue.Push(third) );
+				CHECK( third == Chunk{9} );
+			}
+			THEN( "the producer gets back the preallocated buffers" ) {
+				CHECK( first.empty() );
+				CHECK( first.capacity() >= 4 );
+				CHECK( second.empty() );
+				CHECK( second.capacity() >= 4 );
+			}
+			AND_WHEN( "a chunk is popped" ) {
+				Chunk popped{42};
+				REQUIRE( queue.Pop(popped) );
+				THEN( "it is the oldest chunk" ) {
+					CHECK( popped == Chunk{1, 2, 3, 4} );
+					CHECK( queue.Size() == 1 );
+				}
+				THEN( "the consumer's buffer is handed to the producer on the next push" ) {
+					REQUIRE( queue.Push(third) );
+					CHECK( third == Chunk{42} );
+				}
+			}
+		}
+	}
+	GIVEN( "a producer and a consumer thread" ) {
+		ChunkQueue queue(3, 1);
+		constexpr int COUNT = 10000;
+		std::thread producer([&queue] {
+			Chunk chunk;
+			for(int i = 0; i < COUNT; )
+			{
+				chunk.assign(1, static_cast<AudioSupplier::sample_t>(i));
+				if(queue.Push(chunk))
+					++i;
+				else
+					std::this_thread::yield();
+			}
+		});
+		std::vector<AudioSupplier::sample_t> received;
+		Chunk chunk;
+		while(received.size() < COUNT)
+		{
+			if(queue.Pop(chunk))
+				received.push_back(chunk.front());
+			else
+				std::this_thread::yield();
+		}
+		producer.join();
+		THEN( "every chunk arrives in order" ) {
+			bool inOrder = true;
+			for(int i = 0; i < COUNT; ++i)
+				inOrder &= received[i] == static_cast<AudioSupplier::sample_t>(i);
+			CHECK( inOrder );
+			CHECK( queue.Size() == 0 );
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
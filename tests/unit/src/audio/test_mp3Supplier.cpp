@@ -0,0 +1,162 @@
+/* test_mp3Supplier.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../../source/audio/supplier/Mp3Supplier.h"
+
+// ... and any system includes needed for the test file.
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// The sounds shipped alongside these tests.
+const std::filesystem::path SOUNDS_PATH = std::filesystem::path(__FILE__).parent_path() / "../../../../sounds";
+
+std::vector<std::filesystem::path> ShippedMusic()
+{
+	std::vector<std::filesystem::path> music;
+	for(const auto &entry : std::filesystem::recursive_directory_iterator(SOUNDS_PATH))
+		if(entry.path().extension() == ".mp3")
+			music.push_back(entry.path());
+	return music;
+}
+
+std::unique_ptr<AudioSupplier> OpenMp3(const std::filesystem::path &path, bool looping = false)
+{
+	auto file = std::make_shared<std::fstream>(path, std::ios::in | std::ios::binary);
+	return std::make_unique<Mp3Supplier>(file, looping);
+}
+
+// Take every chunk from the supplier as soon as it is decoded, until it runs out
+// or at least the given number of samples was taken. Returns the number of samples taken.
+size_t Drain(AudioSupplier &supplier, size_t maxSamples = std::numeric_limits<size_t>::max())
+{
+	std::vector<AudioSupplier::sample_t> chunk;
+	size_t samples = 0;
+	while(samples < maxSamples && supplier.MaxChunks())
+	{
+		if(!supplier.AvailableChunks())
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		supplier.NextDataChunk(chunk);
+		samples += chunk.size();
+	}
+	return samples;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Decoding the shipped music", "[Mp3Supplier][audio]" ) {
+	const std::vector<std::filesystem::path> music = ShippedMusic();
+	REQUIRE_FALSE( music.empty() );
+
+	GIVEN( "a supplier that does not loop" ) {
+		std::unique_ptr<AudioSupplier> supplier = OpenMp3(music.front());
+		WHEN( "every chunk is taken" ) {
+			const size_t samples = Drain(*supplier);
+			THEN( "the whole file is decoded into full chunks" ) {
+				CHECK( samples > static_cast<size_t>(AudioSupplier::SAMPLE_RATE) );
+				CHECK( supplier->MaxChunks() == 0 );
+				CHECK( supplier->AvailableChunks() == 0 );
+			}
+		}
+	}
+	GIVEN( "a supplier that loops" ) {
+		std::unique_ptr<AudioSupplier> supplier = OpenMp3(music.front(), true);
+		const size_t fileSamples = Drain(*OpenMp3(music.front()));
+		WHEN( "more samples are taken than the file holds" ) {
+			const size_t samples = Drain(*supplier, 2 * fileSamples + 1);
+			THEN( "it keeps supplying audio" ) {
+				CHECK( samples > 2 * fileSamples );
+				CHECK( supplier->MaxChunks() > 0 );
+			}
+		}
+	}
+	GIVEN( "many suppliers at once" ) {
+		std::vector<std::unique_ptr<AudioSupplier>> suppliers;
+		for(int i = 0; i < 32; ++i)
+			suppliers.push_back(OpenMp3(music[i % music.size()], true));
+		WHEN( "some chunks are taken from each" ) {
+			for(auto &supplier : suppliers)
+				CHECK( Drain(*supplier, AudioSupplier::SAMPLE_RATE) > 0 );
+			THEN( "they can all be destroyed while decoding" ) {
+				suppliers.clear();
+				CHECK( suppliers.empty() );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark decoding the shipped music", "[!benchmark][Mp3Supplier][audio]" ) {
+	const std::vector<std::filesystem::path> music = ShippedMusic();
+	REQUIRE_FALSE( music.empty() );
+
+	// Decode every file at once, as fast as the decoding threads can go, without an audio device.
+	size_t samples = 0;
+	const auto start = std::chrono::steady_clock::now();
+	{
+		std::vector<std::unique_ptr<AudioSupplier>> suppliers;
+		for(const std::filesystem::path &path : music)
+			suppliers.push_back(OpenMp3(path));
+		std::vector<AudioSupplier::sample_t> chunk;
+		for(bool isDecoding = true; isDecoding; )
+		{
+			isDecoding = false;
+			for(auto &supplier : suppliers)
+			{
+				isDecoding |= supplier->MaxChunks() > 0;
+				while(supplier->AvailableChunks())
+				{
+					supplier->NextDataChunk(chunk);
+					samples += chunk.size();
+				}
+			}
+			std::this_thread::yield();
+		}
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	// The samples are in stereo.
+	const double seconds = samples / 2. / AudioSupplier::SAMPLE_RATE;
+	WARN( "Decoded " << seconds << " s of audio from " << music.size() << " files in " << elapsed.count()
+		<< " s (" << seconds / elapsed.count() << "x real time)" );
+
+	BENCHMARK( "Decode one file" ) {
+		return Drain(*OpenMp3(music.front()));
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
@@ -0,0 +1,95 @@
+/* allocation-counter.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "allocation-counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	std::atomic<bool> counting = false;
+	std::atomic<int> allocations = 0;
+	std::atomic<std::size_t> bytes = 0;
+}
+
+// The replacements for the global allocation functions, which count the
+// allocations and otherwise behave like the default ones.
+void *operator new(std::size_t size)
+{
+	if(counting)
+	{
+		++allocations;
+		bytes += size;
+	}
+	if(void *pointer = std::malloc(size ? size : 1))
+		return pointer;
+	throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+
+
+AllocationCounter::AllocationCounter()
+{
+	allocations = 0;
+	bytes = 0;
+	counting = true;
+}
+
+
+
+AllocationCounter::~AllocationCounter()
+{
+	counting = false;
+}
+
+
+
+int AllocationCounter::Count() const
+{
+	return allocations;
+}
+
+
+
+std::size_t AllocationCounter::Bytes() const
+{
+	return bytes;
+}
@@ -0,0 +1,78 @@
+/* shipped-data.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "shipped-data.h"
+
+#include "system-factory.h"
+
+#include "../../../../source/ConditionsStore.h"
+#include "../../../../source/DataFile.h"
+#include "../../../../source/GameData.h"
+#include "../../../../source/Outfit.h"
+
+#include <fstream>
+
+namespace {
+	// The game data shipped alongside these tests.
+	const std::filesystem::path DATA_PATH = std::filesystem::path(__FILE__).parent_path() / "../../../../data";
+}
+
+
+
+// Get the location of the game data shipped alongside the tests.
+const std::filesystem::path &ShippedDataPath()
+{
+	return DATA_PATH;
+}
+
+
+
+// Get all the root nodes with the given key in the shipped game data.
+std::vector<DataNode> ShippedDataNodes(const std::string &key)
+{
+	std::vector<DataNode> nodes;
+	for(const auto &entry : std::filesystem::recursive_directory_iterator(DATA_PATH))
+		if(entry.path().extension() == ".txt")
+		{
+			std::ifstream in(entry.path());
+			for(const DataNode &node : DataFile(in))
+				if(node.Token(0) == key)
+					nodes.push_back(node);
+		}
+	return nodes;
+}
+
+
+
+// Load the systems in the shipped game data into the given set.
+void LoadShippedSystems(Set<System> &systems)
+{
+	LoadSystems(systems, ShippedDataNodes("system"));
+}
+
+
+
+// Load the outfits in the shipped game data into GameData::Outfits().
+void LoadShippedOutfits()
+{
+	static const ConditionsStore conditions;
+	for(const DataNode &node : ShippedDataNodes("outfit"))
+		if(node.Size() >= 2)
+		{
+			// GameData only hands out const outfits; the tests stand in for its loader.
+			auto *outfit = const_cast<Outfit *>(GameData::Outfits().Get(node.Token(1)));
+			outfit->Load(node, &conditions);
+		}
+}
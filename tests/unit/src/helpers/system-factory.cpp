@@ -0,0 +1,56 @@
+/* system-factory.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "system-factory.h"
+
+#include "../../../../source/ConditionsStore.h"
+#include "../../../../source/Planet.h"
+
+#include <set>
+#include <string>
+#include <utility>
+
+
+
+// Load the system definitions in the given nodes into the given set.
+void LoadSystems(Set<System> &systems, const std::vector<DataNode> &nodes)
+{
+	// The planets and conditions must outlive the systems, which refer to them.
+	static const ConditionsStore conditions;
+	static Set<Planet> planets;
+	std::vector<std::pair<System *, std::string>> links;
+	for(const DataNode &node : nodes)
+		if(node.Token(0) == "system" && node.Size() >= 2)
+		{
+			System *system = systems.Get(node.Token(1));
+			DataNode definition;
+			for(const std::string &token : node.Tokens())
+				definition.AddToken(token);
+			for(const DataNode &child : node)
+			{
+				if(child.Token(0) == "link" && child.Size() >= 2)
+					links.emplace_back(system, child.Token(1));
+				else
+					definition.AddChild(child);
+			}
+			system->Load(definition, planets, &conditions);
+		}
+	for(const auto &[system, other] : links)
+		system->Link(systems.Get(other));
+
+	const std::set<double> neighborDistances = {System::DEFAULT_NEIGHBOR_DISTANCE};
+	for(auto &it : systems)
+		it.second.UpdateSystem(systems, neighborDistances);
+}
@@ -0,0 +1,94 @@
+/* test_shipDerivedStats.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../../source/ship/ShipDerivedStats.h"
+
+// ... and any system includes needed for the test file.
+#include "../../../../source/Body.h"
+#include "../../../../source/Outfit.h"
+
+namespace { // test namespace
+
+// #region mock data
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Creating a ShipDerivedStats instance", "[ship][ShipDerivedStats]" ) {
+	GIVEN( "an instance" ) {
+		ShipDerivedStats stats;
+		THEN( "it has the stats of a ship with no attributes" ) {
+			CHECK( stats.MaxShields() == 0. );
+			CHECK( stats.MaxHull() == 0. );
+			CHECK( stats.CoolingEfficiency() == 1. );
+			CHECK( stats.InertiaDivisor() == 1. );
+			CHECK( stats.TurnMultiplier() == 1. );
+			CHECK( stats.AccelerationMultiplier() == 1. );
+			CHECK( stats.RequiredCrew() == 1 );
+		}
+	}
+}
+
+SCENARIO( "Calibrating a ShipDerivedStats instance", "[ship][ShipDerivedStats]" ) {
+	GIVEN( "some ship attributes" ) {
+		Outfit attributes;
+		attributes.Set("shields", 1000.);
+		attributes.Set("shield multiplier", .5);
+		attributes.Set("hull", 2000.);
+		attributes.Set("drag", 4.);
+		attributes.Set("drag reduction", 1.);
+		attributes.Set("inertia reduction", .25);
+		attributes.Set("turn", 300.);
+		attributes.Set("thrust", 20.);
+		attributes.Set("required crew", 3.);
+		ShipDerivedStats stats;
+		WHEN( "the stats are calibrated" ) {
+			stats.Calibrate(attributes);
+			THEN( "the derived values account for multipliers and reductions" ) {
+				CHECK( stats.MaxShields() == 1500. );
+				CHECK( stats.MaxHull() == 2000. );
+				CHECK( stats.Drag() == 2. );
+				CHECK( stats.InertiaDivisor() == 1.25 );
+				CHECK( stats.Turn() == 300. );
+				CHECK( stats.Thrust() == 20. );
+				CHECK( stats.RequiredCrew() == 3 );
+			}
+			THEN( "the default disabled threshold is derived from the maximum hull" ) {
+				CHECK( stats.MinimumHull() == 600. );
+			}
+		}
+		WHEN( "the attributes change after calibration" ) {
+			stats.Calibrate(attributes);
+			attributes.Set("automaton", 1.);
+			attributes.Set("absolute threshold", 100.);
+			THEN( "the stats only change once recalibrated" ) {
+				CHECK( stats.RequiredCrew() == 3 );
+				CHECK( stats.MinimumHull() == 600. );
+				stats.Calibrate(attributes);
+				CHECK( stats.RequiredCrew() == 0 );
+				CHECK( stats.MinimumHull() == 100. );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
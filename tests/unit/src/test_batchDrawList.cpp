@@ -0,0 +1,113 @@
+/* test_batchDrawList.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/shader/BatchDrawList.h"
+
+// Include a helper for counting allocations.
+#include "allocation-counter.h"
+
+// Include helper classes.
+#include "../../../source/Body.h"
+#include "../../../source/image/ImageBuffer.h"
+#include "../../../source/Screen.h"
+#include "../../../source/image/Sprite.h"
+
+// ... and any system includes needed for the test file.
+#include <deque>
+#include <iterator>
+#include <random>
+
+namespace { // test namespace
+
+// #region mock data
+
+// A sprite that can be drawn without uploading any textures.
+class MockSprite : public Sprite {
+public:
+	explicit MockSprite(const std::string &name) : Sprite(name)
+	{
+		ImageBuffer buffer1x;
+		ImageBuffer buffer2x;
+		AddFrames(buffer1x, buffer2x, true);
+	}
+};
+
+// Fill the list as the engine does each frame, with projectiles that are
+// scattered over the screen and use several different sprites.
+void Fill(BatchDrawList &list, const std::deque<Body> &bodies, int step)
+{
+	list.Clear(step);
+	list.SetCenter(Point());
+	for(const Body &body : bodies)
+		list.Add(body);
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Filling a batch draw list", "[BatchDrawList]" ) {
+	Screen::SetRaw(1000, 1000, true);
+	const MockSprite first("first");
+	const MockSprite second("second");
+	const MockSprite third("third");
+	const Sprite *const sprites[] = {&first, &second, &third};
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> coordinate(-400., 400.);
+	std::uniform_int_distribution<size_t> spriteIndex(0, std::size(sprites) - 1);
+	std::deque<Body> bodies;
+	for(int i = 0; i < 500; ++i)
+		bodies.emplace_back(sprites[spriteIndex(gen)], Point(coordinate(gen), coordinate(gen)));
+
+	GIVEN( "a list that has already been filled" ) {
+		BatchDrawList list;
+		Fill(list, bodies, 0);
+		REQUIRE( bodies.front().HasSprite() );
+
+		WHEN( "it is filled again with the same number of sprites" ) {
+			int allocations = 0;
+			{
+				const AllocationCounter counter;
+				for(int step = 1; step < 10; ++step)
+					Fill(list, bodies, step);
+				allocations = counter.Count();
+			}
+			THEN( "no memory is allocated" ) {
+				CHECK( allocations == 0 );
+			}
+		}
+		WHEN( "it is filled again with fewer sprites" ) {
+			bodies.resize(bodies.size() / 2);
+			int allocations = 0;
+			{
+				const AllocationCounter counter;
+				Fill(list, bodies, 1);
+				allocations = counter.Count();
+			}
+			THEN( "no memory is allocated" ) {
+				CHECK( allocations == 0 );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
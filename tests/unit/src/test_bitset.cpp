@@ -154,6 +154,45 @@ TEST_CASE( "Large bitsets", "[bitset]") {
 	CHECK( bitset.Any() );
 }
 
+SCENARIO( "Comparing Bitset instances", "[bitset]" ) {
+	GIVEN( "two bitsets of different sizes" ) {
+		Bitset small;
+		small.Resize(10);
+		Bitset large;
+		large.Resize(200);
+		THEN( "they are equal while no bits are set" ) {
+			CHECK( small == large );
+			CHECK( small.Hash() == large.Hash() );
+		}
+		WHEN( "the same bits are set in both" ) {
+			small.Set(3);
+			large.Set(3);
+			THEN( "they are still equal" ) {
+				CHECK( small == large );
+				CHECK( large == small );
+				CHECK( small.Hash() == large.Hash() );
+			}
+		}
+		WHEN( "a bit is only set in the larger one" ) {
+			small.Set(3);
+			large.Set(3);
+			large.Set(150);
+			THEN( "they are no longer equal" ) {
+				CHECK_FALSE( small == large );
+				CHECK_FALSE( large == small );
+			}
+		}
+		WHEN( "different bits are set in each" ) {
+			small.Set(2);
+			large.Set(3);
+			THEN( "they are not equal" ) {
+				CHECK_FALSE( small == large );
+				CHECK( small.Hash() != large.Hash() );
+			}
+		}
+	}
+}
+
 // Test code goes here. Preferably, use scenario-driven language making use of the SCENARIO, GIVEN,
 // WHEN, and THEN macros. (There will be cases where the more traditional TEST_CASE and SECTION macros
 // are better suited to declaration of the public API.)
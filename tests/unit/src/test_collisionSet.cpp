@@ -0,0 +1,161 @@
+/* test_collisionSet.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/CollisionSet.h"
+
+// ... and any system includes needed for the test file.
+#include "../../../source/Body.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+// A body that can be placed anywhere, standing in for a ship or asteroid.
+class MovingBody : public Body {
+public:
+	explicit MovingBody(Point position) : Body(nullptr, position) {}
+
+	void MoveBy(const Point &offset) { position += offset; }
+};
+
+// Create the given number of bodies scattered over a square of the given size.
+std::deque<MovingBody> MakeBodies(int count, double size, unsigned seed)
+{
+	std::mt19937 gen(seed);
+	std::uniform_real_distribution<double> coordinate(-size, size);
+	std::deque<MovingBody> bodies;
+	for(int i = 0; i < count; ++i)
+		bodies.emplace_back(Point(coordinate(gen), coordinate(gen)));
+	return bodies;
+}
+
+void Fill(CollisionSet &set, std::deque<MovingBody> &bodies, int step)
+{
+	set.Clear(step);
+	for(MovingBody &body : bodies)
+		set.Add(body);
+	set.Finish();
+}
+
+// Query both sets around several points and check that they agree exactly.
+void CheckSameResults(const CollisionSet &incremental, const CollisionSet &rebuilt)
+{
+	for(double x = -2000.; x <= 2000.; x += 500.)
+		for(double y = -2000.; y <= 2000.; y += 500.)
+		{
+			std::vector<Body *> expected;
+			std::vector<Body *> actual;
+			rebuilt.Circle(Point(x, y), 600., expected);
+			incremental.Circle(Point(x, y), 600., actual);
+			CHECK( actual == expected );
+		}
+}
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Updating a CollisionSet incrementally", "[collisionSet]" ) {
+	GIVEN( "an incremental and a rebuilding set with the same bodies" ) {
+		CollisionSet incremental(256u, 32u, CollisionType::SHIP, true);
+		CollisionSet rebuilt(256u, 32u, CollisionType::SHIP, false);
+		auto bodies = MakeBodies(500, 2000., 1u);
+		Fill(incremental, bodies, 0);
+		Fill(rebuilt, bodies, 0);
+		THEN( "they contain the same bodies" ) {
+			CHECK( incremental.All() == rebuilt.All() );
+			CheckSameResults(incremental, rebuilt);
+		}
+		WHEN( "a few bodies move into different cells" ) {
+			for(size_t i = 0; i < bodies.size(); i += 25)
+				bodies[i].MoveBy(Point(300., -300.));
+			Fill(incremental, bodies, 1);
+			Fill(rebuilt, bodies, 1);
+			THEN( "queries return the same results in the same order" ) {
+				CheckSameResults(incremental, rebuilt);
+			}
+		}
+		WHEN( "every body moves" ) {
+			for(MovingBody &body : bodies)
+				body.MoveBy(Point(-700., 450.));
+			Fill(incremental, bodies, 1);
+			Fill(rebuilt, bodies, 1);
+			THEN( "queries return the same results in the same order" ) {
+				CheckSameResults(incremental, rebuilt);
+			}
+		}
+		WHEN( "bodies are removed and added" ) {
+			bodies.pop_front();
+			bodies.emplace_back(Point(10., 10.));
+			Fill(incremental, bodies, 1);
+			Fill(rebuilt, bodies, 1);
+			THEN( "queries return the same results in the same order" ) {
+				CHECK( incremental.All() == rebuilt.All() );
+				CheckSameResults(incremental, rebuilt);
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark CollisionSet updates", "[!benchmark][collisionSet]" ) {
+	// A large fleet battle: ships move a few pixels per step, and asteroids
+	// drift even more slowly, so few of them cross into a new cell each step.
+	auto ships = MakeBodies(2000, 4000., 2u);
+	auto asteroids = MakeBodies(20000, 2048., 3u);
+	const Point shipVelocity(6., -4.);
+	const Point asteroidVelocity(.5, .3);
+
+	auto step = [&](CollisionSet &shipSet, CollisionSet &asteroidSet, int stepCount) -> size_t
+	{
+		for(MovingBody &ship : ships)
+			ship.MoveBy(shipVelocity);
+		for(MovingBody &asteroid : asteroids)
+			asteroid.MoveBy(asteroidVelocity);
+		Fill(shipSet, ships, stepCount);
+		Fill(asteroidSet, asteroids, stepCount);
+		return shipSet.All().size() + asteroidSet.All().size();
+	};
+
+	CollisionSet rebuiltShips(256u, 32u, CollisionType::SHIP, false);
+	CollisionSet rebuiltAsteroids(256u, 16u, CollisionType::ASTEROID, false);
+	int rebuildStep = 0;
+	BENCHMARK( "Full rebuild" ) {
+		return step(rebuiltShips, rebuiltAsteroids, ++rebuildStep);
+	};
+
+	CollisionSet incrementalShips(256u, 32u, CollisionType::SHIP, true);
+	CollisionSet incrementalAsteroids(256u, 16u, CollisionType::ASTEROID, true);
+	int incrementalStep = 0;
+	BENCHMARK( "Incremental update" ) {
+		return step(incrementalShips, incrementalAsteroids, ++incrementalStep);
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
@@ -356,8 +356,85 @@ SCENARIO( "Determining if condition requirements are met", "[ConditionSet][Usage
 	}
 }
 
+SCENARIO( "Evaluating a condition set after the conditions change", "[ConditionSet][Usage]" ) {
+	ConditionsStore store;
+	store.Set("present", 3);
+	const auto set = ConditionSet{AsDataNode("toplevel\n\tpresent + missing + \"prefix: value\" > 2"), &store};
+	const auto sum = ConditionSet{AsDataNode("toplevel\n\tpresent + missing + \"prefix: value\""), &store};
+	REQUIRE( set.Test() );
+	REQUIRE( sum.Evaluate() == 3 );
+
+	GIVEN( "an existing condition is modified" ) {
+		store.Set("present", -5);
+		THEN( "the new value is used" ) {
+			CHECK( sum.Evaluate() == -5 );
+			CHECK_FALSE( set.Test() );
+		}
+	}
+	GIVEN( "a missing condition is added" ) {
+		store.Set("missing", 10);
+		THEN( "the new condition is used" ) {
+			CHECK( sum.Evaluate() == 13 );
+		}
+	}
+	GIVEN( "a prefixed provider is added" ) {
+		int64_t provided = 7;
+		store["prefix: "].ProvidePrefixed([&provided](const ConditionEntry &ce) -> int64_t {
+			return ce.Name() == "prefix: value" ? provided : 0;
+		});
+		THEN( "its value is used" ) {
+			CHECK( sum.Evaluate() == 10 );
+			provided = 100;
+			CHECK( sum.Evaluate() == 103 );
+		}
+	}
+	GIVEN( "a named provider is added" ) {
+		store["missing"].ProvideNamed([](const ConditionEntry &) -> int64_t { return 20; });
+		THEN( "its value is used" ) {
+			CHECK( sum.Evaluate() == 23 );
+		}
+	}
+	GIVEN( "a copy of the condition set" ) {
+		const ConditionSet copy = sum;
+		store.Set("missing", 1);
+		THEN( "both evaluate to the same value" ) {
+			CHECK( copy.Evaluate() == 4 );
+			CHECK( sum.Evaluate() == 4 );
+		}
+	}
+}
 // #endregion unit tests
 
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark ConditionSet::Evaluate", "[!benchmark][ConditionSet]" ) {
+	ConditionsStore store;
+	for(int i = 0; i < 2000; ++i)
+		store.Set("condition " + std::to_string(i), i);
+	store["prefix: "].ProvidePrefixed([](const ConditionEntry &ce) -> int64_t {
+		return static_cast<int64_t>(ce.Name().size());
+	});
+	// A typical mission offer: several conditions combined with and / or / comparisons.
+	const auto offer = ConditionSet{AsDataNode(R"(toplevel
+	"condition 150" >= 100
+	"condition 1500" + "condition 20" * 3 < 5000
+	not "missing condition"
+	or
+		"condition 1999" == 0
+		"prefix: value" > 2
+	"condition 42" != 7)"), &store};
+	REQUIRE( offer.Test() );
+	BENCHMARK( "ConditionSet::Test() of a mission offer" ) {
+		return offer.Test();
+	};
+	const auto literal = ConditionSet{AsDataNode("toplevel\n\t2 + 6 * 8 * 4 - 5 * 22 / 11"), &store};
+	BENCHMARK( "ConditionSet::Evaluate() of a literal expression" ) {
+		return literal.Evaluate();
+	};
+}
+#endif
+// #endregion benchmarks
+
 
 
 } // test namespace
@@ -0,0 +1,197 @@
+/* test_copyOnWrite.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/CopyOnWrite.h"
+
+// Include helpers for counting allocations, creating well-formed DataNodes,
+// and loading the shipped ships.
+#include "allocation-counter.h"
+#include "datanode-factory.h"
+#include "shipped-data.h"
+
+// Include helper classes.
+#include "../../../source/ConditionsStore.h"
+#include "../../../source/Outfit.h"
+#include "../../../source/Set.h"
+#include "../../../source/Ship.h"
+
+// ... and any system includes needed for the test file.
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const std::string OUTFITS = R"(outfit "Test Battery"
+	mass 10
+	"outfit space" -10
+	"energy capacity" 1000
+outfit "Test Generator"
+	mass 20
+	"outfit space" -20
+	"energy generation" 2
+)";
+
+const std::string MODEL = R"(ship "Test Model"
+	attributes
+		mass 100
+		"outfit space" 200
+		hull 500
+		drag 1
+)";
+
+// Load the outfit definitions in the given text into the given set.
+void LoadOutfits(Set<Outfit> &outfits, const std::string &text)
+{
+	for(const DataNode &node : AsDataNodes(text))
+		outfits.Get(node.Token(1))->Load(node, nullptr);
+}
+
+// Load a fully outfitted ship from the shipped game data, to be used as the
+// model that other ships are copied from.
+const Ship &LoadShippedModel(const std::string &name)
+{
+	static const ConditionsStore conditions;
+	static std::unique_ptr<Ship> model;
+	if(model)
+		return *model;
+
+	LoadShippedOutfits();
+	for(const DataNode &node : ShippedDataNodes("ship"))
+		if(node.Size() == 2 && node.Token(1) == name)
+		{
+			model = std::make_unique<Ship>(node, &conditions);
+			model->FinishLoading(true);
+			break;
+		}
+	return *model;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Sharing a value until it is changed", "[CopyOnWrite]" ) {
+	GIVEN( "an empty value" ) {
+		const CopyOnWrite<std::vector<int>> value;
+		THEN( "it can be read as a default-constructed value" ) {
+			CHECK( value->empty() );
+			CHECK_FALSE( value.IsShared() );
+		}
+	}
+	GIVEN( "a value and a copy of it" ) {
+		CopyOnWrite<std::vector<int>> value;
+		value.Mutable() = {1, 2, 3};
+		CopyOnWrite<std::vector<int>> copy = value;
+		THEN( "both refer to the same data" ) {
+			CHECK( &*copy == &*value );
+			CHECK( value.IsShared() );
+			CHECK( copy.IsShared() );
+		}
+		WHEN( "the copy is changed" ) {
+			copy.Mutable().push_back(4);
+			THEN( "only the copy has the change" ) {
+				CHECK( *copy == std::vector<int>{1, 2, 3, 4} );
+				CHECK( *value == std::vector<int>{1, 2, 3} );
+				CHECK_FALSE( value.IsShared() );
+				CHECK_FALSE( copy.IsShared() );
+			}
+			THEN( "changing it again does not copy it again" ) {
+				const std::vector<int> *data = &*copy;
+				copy.Mutable().push_back(5);
+				CHECK( &*copy == data );
+			}
+		}
+		WHEN( "the original is changed" ) {
+			value.Mutable().clear();
+			THEN( "the copy still has the old value" ) {
+				CHECK( value->empty() );
+				CHECK( *copy == std::vector<int>{1, 2, 3} );
+			}
+		}
+	}
+}
+
+SCENARIO( "Creating ships from a model", "[CopyOnWrite][ship]" ) {
+	GIVEN( "a model ship with outfits" ) {
+		Set<Outfit> outfits;
+		LoadOutfits(outfits, OUTFITS);
+		const Outfit *battery = outfits.Get("Test Battery");
+		const Outfit *generator = outfits.Get("Test Generator");
+		Ship model(AsDataNode(MODEL), nullptr);
+		model.AddOutfit(battery, 2);
+		model.AddOutfit(generator, 1);
+		model.FinishLoading(true);
+		REQUIRE( model.OutfitCount(battery) == 2 );
+
+		WHEN( "a ship is copied from it" ) {
+			Ship ship(model);
+			THEN( "the copy shares the model's outfits and attributes" ) {
+				CHECK( &ship.Outfits() == &model.Outfits() );
+				CHECK( &ship.Attributes() == &model.Attributes() );
+				CHECK( &ship.BaseAttributes() == &model.BaseAttributes() );
+			}
+			AND_WHEN( "an outfit is added to the copy" ) {
+				ship.AddOutfit(battery, 1);
+				THEN( "only the copy has the new outfit" ) {
+					CHECK( ship.OutfitCount(battery) == 3 );
+					CHECK( model.OutfitCount(battery) == 2 );
+					CHECK( &ship.Outfits() != &model.Outfits() );
+					CHECK( ship.Attributes().Mass() == model.Attributes().Mass() + battery->Mass() );
+				}
+				THEN( "the base attributes are still shared" ) {
+					CHECK( &ship.BaseAttributes() == &model.BaseAttributes() );
+				}
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark creating ships from a model", "[!benchmark][CopyOnWrite][ship]" ) {
+	const Ship &model = LoadShippedModel("Bactrian");
+	// A large fleet spawning in a system creates this many ships from the same model.
+	constexpr int SHIPS = 200;
+	const auto spawn = [&model]() {
+		std::vector<std::shared_ptr<Ship>> ships;
+		ships.reserve(SHIPS);
+		for(int i = 0; i < SHIPS; ++i)
+			ships.push_back(std::make_shared<Ship>(model));
+		return ships;
+	};
+
+	{
+		const AllocationCounter counter;
+		const auto ships = spawn();
+		WARN( "Per ship: " << counter.Count() / SHIPS << " allocations, " << counter.Bytes() / SHIPS << " bytes" );
+	}
+	BENCHMARK( "200 ships" ) {
+		return spawn();
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
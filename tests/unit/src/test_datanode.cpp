@@ -43,7 +43,7 @@ TEST_CASE( "DataNode Basics", "[DataNode]" ) {
 	SECTION( "Class Traits" ) {
 		CHECK_FALSE( std::is_trivial_v<T> );
 		// The class layout apparently satisfies StandardLayoutType when building/testing for Steam, but false otherwise.
-		// This may change in the future, with the expectation of false everywhere (due to the list<DataNode> field).
+		// This may change in the future, with the expectation of false everywhere (due to the vector<DataNode> field).
 		// CHECK_FALSE( std::is_standard_layout_v<T> );
 		CHECK( std::is_nothrow_destructible_v<T> );
 		CHECK_FALSE( std::is_trivially_destructible_v<T> );
@@ -64,7 +64,7 @@ TEST_CASE( "DataNode Basics", "[DataNode]" ) {
 	}
 	SECTION( "Copy Traits" ) {
 		CHECK( std::is_copy_assignable_v<T> );
-		// The class data can be spread out due to vector + list contents.
+		// The class data can be spread out due to nested vector contents.
 		CHECK_FALSE( std::is_trivially_copyable_v<T> );
 		// We have work to do when copying.
 		CHECK_FALSE( std::is_trivially_copy_assignable_v<T> );
@@ -53,6 +53,63 @@ SCENARIO( "A Dictionary instance is being used", "[dictionary]") {
 	}
 }
 
+SCENARIO( "Looking up a Dictionary by a pre-resolved key", "[dictionary]") {
+	GIVEN( "a dictionary with some elements" ) {
+		Dictionary dict;
+		dict["delta"] = 4.;
+		dict["bravo"] = 2.;
+		dict["foxtrot"] = 6.;
+		const Dictionary::Key alpha("alpha");
+		const Dictionary::Key bravo("bravo");
+		const Dictionary::Key delta("delta");
+		const Dictionary::Key foxtrot("foxtrot");
+		THEN( "keys find the same values as names" ) {
+			CHECK( dict.Get(bravo) == dict.Get("bravo") );
+			CHECK( dict.Get(delta) == dict.Get("delta") );
+			CHECK( dict.Get(foxtrot) == dict.Get("foxtrot") );
+			CHECK( dict.Get(alpha) == 0. );
+		}
+		WHEN( "an element is inserted before the others" ) {
+			dict["alpha"] = 1.;
+			THEN( "every key still finds its value" ) {
+				CHECK( dict.Get(alpha) == 1. );
+				CHECK( dict.Get(bravo) == 2. );
+				CHECK( dict.Get(delta) == 4. );
+				CHECK( dict.Get(foxtrot) == 6. );
+			}
+		}
+		WHEN( "an element is erased" ) {
+			dict.Erase("bravo");
+			THEN( "the erased key is no longer found" ) {
+				CHECK( dict.Get(bravo) == 0. );
+			}
+			THEN( "every other key still finds its value" ) {
+				CHECK( dict.Get(delta) == 4. );
+				CHECK( dict.Get(foxtrot) == 6. );
+			}
+		}
+		WHEN( "more elements are added after the keys were registered" ) {
+			dict["echo"] = 5.;
+			dict["charlie"] = 3.;
+			THEN( "every key finds its value by its position" ) {
+				CHECK( dict.Get(bravo) == 2. );
+				CHECK( dict.Get(delta) == 4. );
+				CHECK( dict.Get(Dictionary::Key("echo")) == 5. );
+				CHECK( dict.Get(foxtrot) == 6. );
+			}
+		}
+		WHEN( "the dictionary is copied" ) {
+			Dictionary copy = dict;
+			copy["charlie"] = 3.;
+			THEN( "the copy and the original are independent" ) {
+				CHECK( copy.Get(Dictionary::Key("charlie")) == 3. );
+				CHECK( dict.Get(Dictionary::Key("charlie")) == 0. );
+				CHECK( copy.Get(delta) == 4. );
+			}
+		}
+	}
+}
+
 // #region benchmarks
 #ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
 TEST_CASE( "Benchmark Dictionary::Get", "[!benchmark][dictionary]" ) {
@@ -76,6 +133,37 @@ TEST_CASE( "Benchmark Dictionary::Get", "[!benchmark][dictionary]" ) {
 		return dict.Get(strings[i % SIZE]);
 	};
 }
+
+TEST_CASE( "Benchmark Dictionary::Get by key", "[!benchmark][dictionary]" ) {
+	// A typical ship has about this many attributes, and queries a few dozen of
+	// them every step in Ship::DoGeneration() and Ship::DoMovement().
+	constexpr int SIZE = 100;
+	constexpr int QUERIES = 40;
+
+	std::vector<std::string> strings;
+	for(int i = 0; i < SIZE; ++i)
+		strings.emplace_back("benchmark attribute " + std::to_string(i));
+	// Like the keys in Attribute.h, these are registered before any attributes are loaded.
+	std::vector<Dictionary::Key> keys;
+	for(int i = 0; i < QUERIES; ++i)
+		keys.emplace_back(strings[(i * 7) % SIZE].c_str());
+	Dictionary dict;
+	for(int i = 0; i < SIZE; ++i)
+		dict[strings[i]] = i;
+
+	BENCHMARK( "Dictionary::Get(const char *)" ) {
+		double sum = 0.;
+		for(int i = 0; i < QUERIES; ++i)
+			sum += dict.Get(strings[(i * 7) % SIZE].c_str());
+		return sum;
+	};
+	BENCHMARK( "Dictionary::Get(const Key &)" ) {
+		double sum = 0.;
+		for(const Dictionary::Key &key : keys)
+			sum += dict.Get(key);
+		return sum;
+	};
+}
 #endif
 // #endregion benchmarks
 
@@ -0,0 +1,159 @@
+/* test_distanceMap.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/DistanceMap.h"
+
+// Include helpers for creating well-formed DataNodes and maps of systems.
+#include "datanode-factory.h"
+#include "shipped-data.h"
+#include "system-factory.h"
+
+// Include helper classes.
+#include "../../../source/RoutePlan.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+
+// ... and any system includes needed for the test file.
+#include <random>
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// A small map: a hub with two branches that meet again further out, so that
+// some systems can be reached in more than one way, and a system that can not
+// be reached at all.
+const std::string MAP = R"(system "Route Hub"
+	pos 0 0
+	link "Route North"
+	link "Route East"
+system "Route North"
+	pos 0 -100
+	link "Route Hub"
+	link "Route Far North"
+system "Route Far North"
+	pos 0 -200
+	link "Route North"
+	link "Route Far East"
+system "Route East"
+	pos 100 0
+	link "Route Hub"
+	link "Route Far East"
+system "Route Far East"
+	pos 200 0
+	link "Route East"
+	link "Route Far North"
+	link "Route Edge"
+system "Route Edge"
+	pos 300 0
+	link "Route Far East"
+system "Route Isolated"
+	pos 5000 5000
+)";
+
+// Pick the given number of destinations in the given map at random, as if
+// that many ships in the same system were each heading somewhere else.
+std::vector<const System *> Destinations(const Set<System> &map, size_t count)
+{
+	std::vector<const System *> systems;
+	for(const auto &it : map)
+		systems.push_back(&it.second);
+	std::mt19937 gen(7);
+	std::uniform_int_distribution<size_t> index(0, systems.size() - 1);
+	std::vector<const System *> destinations;
+	for(size_t i = 0; i < count; ++i)
+		destinations.push_back(systems[index(gen)]);
+	return destinations;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Finding routes by continuing a search", "[DistanceMap]" ) {
+	GIVEN( "a small map" ) {
+		Set<System> systems;
+		LoadSystems(systems, AsDataNodes(MAP));
+		const System &hub = *systems.Get("Route Hub");
+		const System &neighbor = *systems.Get("Route North");
+		const System &far = *systems.Get("Route Edge");
+
+		WHEN( "the routes to many destinations are found from the same search" ) {
+			DistanceMap search(hub, nullptr);
+			THEN( "each route is the same as one found on its own" ) {
+				for(const auto &destination : systems)
+				{
+					INFO( destination.first );
+					const RoutePlan resumed(search, destination.second);
+					const RoutePlan fresh(hub, destination.second);
+					CHECK( resumed.HasRoute() == fresh.HasRoute() );
+					CHECK( resumed.Days() == fresh.Days() );
+					CHECK( resumed.RequiredFuel() == fresh.RequiredFuel() );
+					CHECK( resumed.Plan() == fresh.Plan() );
+				}
+			}
+			THEN( "routes to systems that were already reached can be found again" ) {
+				const RoutePlan first(search, neighbor);
+				const RoutePlan farther(search, far);
+				REQUIRE( farther.HasRoute() );
+				CHECK( farther.Days() == 3 );
+				const RoutePlan again(search, neighbor);
+				CHECK( again.HasRoute() );
+				CHECK( again.Days() == 1 );
+				CHECK( again.Plan() == first.Plan() );
+			}
+			THEN( "there is no route to the starting system or an unreachable one" ) {
+				CHECK_FALSE( RoutePlan(search, hub).HasRoute() );
+				CHECK_FALSE( RoutePlan(search, *systems.Get("Route Isolated")).HasRoute() );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark routing ships from a hub system", "[!benchmark][DistanceMap]" ) {
+	Set<System> systems;
+	LoadShippedSystems(systems);
+	const System &hub = *systems.Get("Sol");
+	const std::vector<const System *> destinations = Destinations(systems, 1000);
+
+	BENCHMARK( "1000 routes, each searched separately" ) {
+		int days = 0;
+		for(const System *destination : destinations)
+			days += RoutePlan(hub, *destination).Days();
+		return days;
+	};
+	BENCHMARK( "1000 routes, continuing one search" ) {
+		DistanceMap search(hub, nullptr);
+		int days = 0;
+		for(const System *destination : destinations)
+			days += RoutePlan(search, *destination).Days();
+		return days;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
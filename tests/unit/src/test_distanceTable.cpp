@@ -0,0 +1,157 @@
+/* test_distanceTable.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/DistanceTable.h"
+
+// Include helpers for creating well-formed DataNodes and maps of systems.
+#include "datanode-factory.h"
+#include "shipped-data.h"
+#include "system-factory.h"
+
+// Include helper classes.
+#include "../../../source/DistanceMap.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+
+// ... and any system includes needed for the test file.
+#include <string>
+
+namespace { // test namespace
+
+// #region mock data
+
+// A small map: a line of linked systems, with one system that is only in jump
+// drive range of the others, and one that can not be reached at all.
+const std::string MAP = R"(system "Distance A"
+	pos 0 0
+	link "Distance B"
+system "Distance B"
+	pos 50 0
+	link "Distance A"
+	link "Distance C"
+system "Distance C"
+	pos 100 0
+	link "Distance B"
+system "Distance D"
+	pos 100 80
+system "Distance E"
+	pos 5000 5000
+)";
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Looking up the distance between systems", "[DistanceTable]" ) {
+	GIVEN( "a small map" ) {
+		Set<System> systems;
+		LoadSystems(systems, AsDataNodes(MAP));
+		const System &a = *systems.Get("Distance A");
+		const System &c = *systems.Get("Distance C");
+		const System &d = *systems.Get("Distance D");
+		const System &e = *systems.Get("Distance E");
+
+		DistanceTable table;
+		table.Update(systems);
+		THEN( "systems connected by hyperspace links can be reached" ) {
+			CHECK( table.Days(a, a, WormholeStrategy::NONE, false) == 0 );
+			CHECK( table.Days(a, c, WormholeStrategy::NONE, false) == 2 );
+			CHECK( table.Days(c, a, WormholeStrategy::NONE, false) == 2 );
+		}
+		THEN( "systems in jump range can only be reached with a jump drive" ) {
+			CHECK( table.Days(a, d, WormholeStrategy::NONE, false) == -1 );
+			CHECK( table.Days(a, d, WormholeStrategy::NONE, true) == DistanceMap(&a, WormholeStrategy::NONE, true).Days(d) );
+			CHECK( table.Days(a, d, WormholeStrategy::NONE, true) > 0 );
+		}
+		THEN( "systems that are too far away can not be reached" ) {
+			CHECK( table.Days(a, e, WormholeStrategy::ALL, true) == -1 );
+			CHECK( table.Days(e, a, WormholeStrategy::ALL, true) == -1 );
+		}
+		THEN( "every distance is the same as DistanceMap finds" ) {
+			for(bool useJumpDrive : {false, true})
+				for(const auto &from : systems)
+				{
+					const DistanceMap distance(&from.second, WormholeStrategy::ALL, useJumpDrive);
+					for(const auto &to : systems)
+					{
+						INFO( from.first + " to " + to.first );
+						CHECK( table.Days(from.second, to.second, WormholeStrategy::ALL, useJumpDrive)
+							== distance.Days(to.second) );
+					}
+				}
+		}
+		THEN( "only the rows that were needed are stored" ) {
+			CHECK( table.MemoryUse() == 0 );
+			table.Days(a, c, WormholeStrategy::NONE, false);
+			const size_t oneRow = table.MemoryUse();
+			CHECK( oneRow > 0 );
+			table.Days(a, d, WormholeStrategy::NONE, false);
+			CHECK( table.MemoryUse() == oneRow );
+			table.Clear();
+			table.Days(c, a, WormholeStrategy::NONE, false);
+			CHECK( table.MemoryUse() == oneRow );
+		}
+		WHEN( "a system is added after the table was built" ) {
+			LoadSystems(systems, AsDataNodes("system \"Distance F\"\n\tpos 150 0\n\tlink \"Distance C\""));
+			const System &f = *systems.Get("Distance F");
+			THEN( "it is found once the systems are indexed again" ) {
+				CHECK( table.Days(f, a, WormholeStrategy::NONE, false) == 3 );
+				table.Update(systems);
+				CHECK( table.Days(f, a, WormholeStrategy::NONE, false) == 3 );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark looking up distances in the shipped map", "[!benchmark][DistanceTable]" ) {
+	Set<System> systems;
+	LoadShippedSystems(systems);
+	REQUIRE( systems.size() > 0 );
+	const System &from = *systems.Get("Sol");
+
+	DistanceTable table;
+	table.Update(systems);
+	int mismatches = 0;
+	const DistanceMap distance(&from, WormholeStrategy::ALL, true);
+	for(const auto &to : systems)
+		mismatches += table.Days(from, to.second, WormholeStrategy::ALL, true) != distance.Days(to.second);
+	CHECK( mismatches == 0 );
+
+	BENCHMARK( "Every distance from one system, with a new DistanceMap each time" ) {
+		int days = 0;
+		for(const auto &to : systems)
+			days += DistanceMap(&from, WormholeStrategy::ALL, true).Days(to.second);
+		return days;
+	};
+	BENCHMARK( "Every distance from one system, from the table" ) {
+		int days = 0;
+		for(const auto &to : systems)
+			days += table.Days(from, to.second, WormholeStrategy::ALL, true);
+		return days;
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
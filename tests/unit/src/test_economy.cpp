@@ -0,0 +1,222 @@
+/* test_economy.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Economy.h"
+
+// Include helpers for creating well-formed DataNodes and maps of systems.
+#include "datanode-factory.h"
+#include "shipped-data.h"
+#include "system-factory.h"
+
+// Include helper classes.
+#include "../../../source/Random.h"
+#include "../../../source/Set.h"
+#include "../../../source/System.h"
+#include "../../../source/Trade.h"
+
+// ... and any system includes needed for the test file.
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const std::string TRADE = R"(trade
+	commodity "Food" 100 600
+	commodity "Clothing" 140 440
+	commodity "Metal" 190 570
+)";
+
+// A small map in which not every system trades every commodity, one system
+// trades nothing, and one system trades but has no links.
+const std::string MAP = R"(system "Trade A"
+	pos 0 0
+	link "Trade B"
+	link "Trade C"
+	trade "Food" 300
+	trade "Clothing" 250
+	trade "Metal" 400
+system "Trade B"
+	pos 100 0
+	link "Trade A"
+	link "Trade C"
+	trade "Food" 500
+	trade "Clothing" 300
+system "Trade C"
+	pos 0 100
+	link "Trade A"
+	link "Trade B"
+	link "Trade D"
+	trade "Food" 200
+	trade "Metal" 350
+system "Trade D"
+	pos 100 100
+	link "Trade C"
+system "Trade E"
+	pos 5000 5000
+	trade "Food" 400
+)";
+
+// Load the commodities from the given trade definitions.
+Trade LoadCommodities(const std::vector<DataNode> &nodes)
+{
+	Trade trade;
+	for(const DataNode &node : nodes)
+		trade.Load(node);
+	return trade;
+}
+
+// Step the economy one day the way GameData did before it used an Economy,
+// looking up each commodity of each system by name.
+void StepByName(Set<System> &systems, const std::vector<Trade::Commodity> &commodities)
+{
+	for(auto &it : systems)
+		it.second.StepEconomy();
+
+	for(auto &it : systems)
+	{
+		System &system = it.second;
+		if(!system.Links().empty())
+			for(const Trade::Commodity &commodity : commodities)
+			{
+				double supply = system.Supply(commodity.name);
+				for(const System *neighbor : system.Links())
+				{
+					double scale = neighbor->Links().size();
+					if(scale)
+						supply += neighbor->Exports(commodity.name) / scale;
+				}
+				system.SetSupply(commodity.name, supply);
+			}
+	}
+}
+
+// Get the supply of every commodity in every system.
+std::vector<double> Supplies(const Set<System> &systems, const std::vector<Trade::Commodity> &commodities)
+{
+	std::vector<double> supplies;
+	for(const auto &it : systems)
+		for(const Trade::Commodity &commodity : commodities)
+			supplies.push_back(it.second.Supply(commodity.name));
+	return supplies;
+}
+
+// Get the price of every commodity in every system.
+std::vector<int> Prices(const Set<System> &systems, const std::vector<Trade::Commodity> &commodities)
+{
+	std::vector<int> prices;
+	for(const auto &it : systems)
+		for(const Trade::Commodity &commodity : commodities)
+			prices.push_back(it.second.Trade(commodity.name));
+	return prices;
+}
+
+// Reset the supply of every commodity in every system.
+void SetSupplies(Set<System> &systems, const std::vector<Trade::Commodity> &commodities,
+	const std::vector<double> &supplies)
+{
+	auto supply = supplies.begin();
+	for(auto &it : systems)
+		for(const Trade::Commodity &commodity : commodities)
+			it.second.SetSupply(commodity.name, *supply++);
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Simulating the economy of a small map", "[Economy]" ) {
+	GIVEN( "a map and commodities" ) {
+		Set<System> systems;
+		LoadSystems(systems, AsDataNodes(MAP));
+		const Trade trade = LoadCommodities(AsDataNodes(TRADE));
+		const std::vector<Trade::Commodity> &commodities = trade.Commodities();
+		REQUIRE( commodities.size() == 3 );
+		const std::vector<double> initialSupplies = Supplies(systems, commodities);
+
+		WHEN( "it is stepped for a while" ) {
+			constexpr int DAYS = 100;
+			Random::Seed(42);
+			std::vector<std::vector<int>> expectedPrices;
+			for(int day = 0; day < DAYS; ++day)
+			{
+				StepByName(systems, commodities);
+				expectedPrices.push_back(Prices(systems, commodities));
+			}
+			const std::vector<double> expectedSupplies = Supplies(systems, commodities);
+
+			SetSupplies(systems, commodities, initialSupplies);
+			Random::Seed(42);
+			Economy economy;
+			economy.Update(systems, commodities);
+			std::vector<std::vector<int>> prices;
+			for(int day = 0; day < DAYS; ++day)
+			{
+				economy.Step();
+				prices.push_back(Prices(systems, commodities));
+			}
+
+			THEN( "the prices are the same as when looking up each commodity by name" ) {
+				CHECK( prices == expectedPrices );
+				CHECK( Supplies(systems, commodities) == expectedSupplies );
+			}
+			THEN( "the prices change from day to day" ) {
+				CHECK( prices.front() != prices.back() );
+			}
+			THEN( "commodities that a system does not trade have no price" ) {
+				CHECK( systems.Get("Trade B")->Trade("Metal") == 0 );
+				CHECK( systems.Get("Trade D")->Trade("Food") == 0 );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark stepping the economy", "[!benchmark][Economy]" ) {
+	Set<System> systems;
+	LoadShippedSystems(systems);
+	const Trade trade = LoadCommodities(ShippedDataNodes("trade"));
+	const std::vector<Trade::Commodity> &commodities = trade.Commodities();
+	const std::vector<double> initialSupplies = Supplies(systems, commodities);
+	constexpr int DAYS = 10000;
+
+	BENCHMARK( "10000 days, looking up each commodity by name" ) {
+		for(int day = 0; day < DAYS; ++day)
+			StepByName(systems, commodities);
+		return systems.size();
+	};
+	SetSupplies(systems, commodities, initialSupplies);
+	BENCHMARK( "10000 days, using Economy::Step()" ) {
+		Economy economy;
+		economy.Update(systems, commodities);
+		for(int day = 0; day < DAYS; ++day)
+			economy.Step();
+		return systems.size();
+	};
+	SetSupplies(systems, commodities, initialSupplies);
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
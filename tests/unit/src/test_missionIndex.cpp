@@ -0,0 +1,119 @@
+/* test_missionIndex.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/MissionIndex.h"
+
+// Include a helper for creating well-formed DataNodes.
+#include "datanode-factory.h"
+
+// Include helper classes.
+#include "../../../source/ConditionsStore.h"
+#include "../../../source/DataNode.h"
+#include "../../../source/GameData.h"
+#include "../../../source/Mission.h"
+#include "../../../source/Planet.h"
+
+// ... and any system includes needed for the test file.
+#include <set>
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+const std::string MISSIONS = R"(mission "Anywhere"
+mission "Boarding"
+	boarding
+mission "Disabled"
+	to offer
+		never
+mission "From Alpha"
+	source "Alpha"
+mission "From Alpha or Beta"
+	source
+		planet "Beta" "Alpha"
+mission "With conditions"
+	to offer
+		has "something"
+)";
+
+// Load the given mission definitions into the given set.
+void LoadMissions(Set<Mission> &missions, const std::string &text, const ConditionsStore &conditions)
+{
+	const std::set<const System *> visitedSystems;
+	const std::set<const Planet *> visitedPlanets;
+	for(const DataNode &node : AsDataNodes(text))
+		missions.Get(node.Token(1))->Load(node, &conditions, &visitedSystems, &visitedPlanets);
+}
+
+std::vector<std::string> Names(const std::vector<const Mission *> &missions)
+{
+	std::vector<std::string> names;
+	for(const Mission *mission : missions)
+		names.push_back(mission->TrueName());
+	return names;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Finding the missions that may be offered on a planet", "[MissionIndex]" ) {
+	const ConditionsStore conditions;
+	Set<Mission> missions;
+	LoadMissions(missions, MISSIONS, conditions);
+	const Planet *alpha = GameData::Planets().Get("Alpha");
+	const Planet *beta = GameData::Planets().Get("Beta");
+	const Planet *gamma = GameData::Planets().Get("Gamma");
+
+	MissionIndex index;
+	index.Update(missions);
+	GIVEN( "a planet that missions are limited to" ) {
+		THEN( "those missions and the ones that are not limited to any planet are included, in order" ) {
+			CHECK( Names(index.Candidates(alpha)) == std::vector<std::string>{
+				"Anywhere", "From Alpha", "From Alpha or Beta", "With conditions"} );
+			CHECK( Names(index.Candidates(beta)) == std::vector<std::string>{
+				"Anywhere", "From Alpha or Beta", "With conditions"} );
+		}
+	}
+	GIVEN( "a planet that no mission is limited to" ) {
+		THEN( "only the missions that are not limited to any planet are included" ) {
+			CHECK( Names(index.Candidates(gamma)) == std::vector<std::string>{"Anywhere", "With conditions"} );
+		}
+	}
+	GIVEN( "no planet" ) {
+		THEN( "no missions are included" ) {
+			CHECK( index.Candidates(nullptr).empty() );
+		}
+	}
+	GIVEN( "a mission that is defined after the index was built" ) {
+		LoadMissions(missions, "mission \"Also Anywhere\"", conditions);
+		index.Update(missions);
+		THEN( "it is included as well" ) {
+			CHECK( Names(index.Candidates(gamma)) == std::vector<std::string>{
+				"Also Anywhere", "Anywhere", "With conditions"} );
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
@@ -0,0 +1,126 @@
+/* test_politics.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Politics.h"
+
+// Include a helper for creating well-formed DataNodes.
+#include "datanode-factory.h"
+
+// Include helper classes.
+#include "../../../source/DataNode.h"
+#include "../../../source/Government.h"
+#include "../../../source/Set.h"
+
+// ... and any system includes needed for the test file.
+#include <set>
+#include <string>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Governments that are hostile to everyone, to no one, and friendly to everyone.
+const std::string GOVERNMENTS = R"(
+government "Pirate"
+	"default attitude" -1
+government "Merchant"
+	"default attitude" 0
+government "Militia"
+	"default attitude" .5
+)";
+
+// Load the given government definitions into the given set.
+void LoadGovernments(Set<Government> &governments, const std::string &text)
+{
+	const std::set<const System *> visitedSystems;
+	const std::set<const Planet *> visitedPlanets;
+	for(const DataNode &node : AsDataNodes(text))
+		governments.Get(node.Token(1))->Load(node, &visitedSystems, &visitedPlanets);
+}
+
+// The hostility check as it was done before the table existed, for governments
+// other than the player's.
+bool ReferenceIsEnemy(const Government *first, const Government *second)
+{
+	if(!first || !second || first == second)
+		return false;
+	return first->AttitudeToward(second) < 0. || second->AttitudeToward(first) < 0.;
+}
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Checking whether governments are enemies", "[Politics]" ) {
+	Set<Government> governments;
+	LoadGovernments(governments, GOVERNMENTS);
+	const Government *pirate = governments.Get("Pirate");
+	const Government *merchant = governments.Get("Merchant");
+	const Government *militia = governments.Get("Militia");
+
+	GIVEN( "a hostility table built from the governments" ) {
+		Politics politics;
+		politics.UpdateHostility(governments);
+		THEN( "every pair of governments has the same hostility as their attitudes give" ) {
+			for(const auto &first : governments)
+				for(const auto &second : governments)
+				{
+					INFO( first.first + " / " + second.first );
+					CHECK( politics.IsEnemy(&first.second, &second.second)
+						== ReferenceIsEnemy(&first.second, &second.second) );
+				}
+			CHECK( politics.IsEnemy(pirate, merchant) );
+			CHECK( politics.IsEnemy(militia, pirate) );
+			CHECK_FALSE( politics.IsEnemy(merchant, militia) );
+			CHECK_FALSE( politics.IsEnemy(pirate, pirate) );
+		}
+		THEN( "null governments are never enemies" ) {
+			CHECK_FALSE( politics.IsEnemy(nullptr, pirate) );
+			CHECK_FALSE( politics.IsEnemy(pirate, nullptr) );
+			CHECK_FALSE( politics.IsEnemy(nullptr, nullptr) );
+		}
+	}
+	GIVEN( "governments whose attitudes change after the table is built" ) {
+		Politics politics;
+		politics.UpdateHostility(governments);
+		REQUIRE_FALSE( politics.IsEnemy(merchant, militia) );
+
+		LoadGovernments(governments, "government \"Merchant\"\n\t\"default attitude\" -1");
+		WHEN( "the table is rebuilt" ) {
+			politics.UpdateHostility(governments);
+			THEN( "the new attitudes are reflected in both directions" ) {
+				CHECK( politics.IsEnemy(merchant, militia) );
+				CHECK( politics.IsEnemy(militia, merchant) );
+			}
+		}
+		WHEN( "a government is created after the table was built" ) {
+			const Government *newcomer = governments.Get("Newcomer");
+			THEN( "its hostility is still determined correctly" ) {
+				CHECK( politics.IsEnemy(newcomer, pirate) );
+				CHECK( politics.IsEnemy(newcomer, militia) == ReferenceIsEnemy(newcomer, militia) );
+				CHECK_FALSE( politics.IsEnemy(newcomer, newcomer) );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+
+
+} // test namespace
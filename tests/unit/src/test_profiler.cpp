@@ -0,0 +1,171 @@
+/* test_profiler.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../source/Profiler.h"
+
+// ... and any system includes needed for the test file.
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Find the summary of the scopes with the given name, if any.
+const Profiler::Summary *Find(const std::vector<Profiler::Summary> &summaries, const std::string &name)
+{
+	for(const Profiler::Summary &summary : summaries)
+		if(summary.name == name)
+			return &summary;
+	return nullptr;
+}
+
+// Enable the profiler for the lifetime of a test, and disable it afterwards.
+class EnabledProfiler {
+public:
+	EnabledProfiler() { Profiler::SetEnabled(true); }
+	~EnabledProfiler() { Profiler::SetEnabled(false); }
+};
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Recording scopes", "[Profiler]" ) {
+	const auto since = std::chrono::steady_clock::now();
+	GIVEN( "a disabled profiler" ) {
+		Profiler::SetEnabled(false);
+		WHEN( "a scope ends" ) {
+			{
+				Profiler::Scope scope("disabled scope");
+			}
+			THEN( "nothing is recorded" ) {
+				CHECK( Find(Profiler::Summarize(since), "disabled scope") == nullptr );
+			}
+		}
+	}
+	GIVEN( "an enabled profiler" ) {
+		const EnabledProfiler enabled;
+		REQUIRE( Profiler::IsEnabled() );
+		WHEN( "scopes end" ) {
+			for(int i = 0; i < 3; ++i)
+			{
+				Profiler::Scope scope("short scope");
+			}
+			{
+				Profiler::Scope scope("long scope");
+				std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			}
+			const std::vector<Profiler::Summary> summaries = Profiler::Summarize(since);
+			THEN( "each name is summarized once, with the number of scopes" ) {
+				const Profiler::Summary *shortScope = Find(summaries, "short scope");
+				const Profiler::Summary *longScope = Find(summaries, "long scope");
+				REQUIRE( shortScope );
+				REQUIRE( longScope );
+				CHECK( shortScope->count == 3 );
+				CHECK( longScope->count == 1 );
+				CHECK( longScope->time >= std::chrono::milliseconds(2) );
+			}
+			THEN( "the longest total time is first" ) {
+				REQUIRE_FALSE( summaries.empty() );
+				CHECK( summaries.front().name == "long scope" );
+			}
+			THEN( "scopes that ended before the given time are not summarized" ) {
+				CHECK( Find(Profiler::Summarize(std::chrono::steady_clock::now()), "long scope") == nullptr );
+			}
+		}
+		WHEN( "scopes end in other threads" ) {
+			std::vector<std::thread> threads;
+			for(int i = 0; i < 4; ++i)
+				threads.emplace_back([] {
+					for(int j = 0; j < 10; ++j)
+						Profiler::Scope scope("thread scope");
+				});
+			for(std::thread &thread : threads)
+				thread.join();
+			THEN( "the records of every thread are summarized" ) {
+				const std::vector<Profiler::Summary> summaries = Profiler::Summarize(since);
+				const Profiler::Summary *summary = Find(summaries, "thread scope");
+				REQUIRE( summary );
+				CHECK( summary->count == 40 );
+			}
+		}
+		WHEN( "more scopes end than the buffer can hold" ) {
+			for(int i = 0; i < 100000; ++i)
+				Profiler::Scope scope("many scopes");
+			THEN( "only the most recent ones are kept" ) {
+				const std::vector<Profiler::Summary> summaries = Profiler::Summarize(since);
+				const Profiler::Summary *summary = Find(summaries, "many scopes");
+				REQUIRE( summary );
+				CHECK( summary->count > 0 );
+				CHECK( summary->count < 100000 );
+			}
+		}
+	}
+}
+
+SCENARIO( "Writing a trace", "[Profiler]" ) {
+	GIVEN( "some recorded scopes" ) {
+		{
+			const EnabledProfiler enabled;
+			Profiler::Scope outer("outer \"scope\"");
+			Profiler::Scope inner("inner scope");
+		}
+		WHEN( "the trace is written" ) {
+			const std::filesystem::path path = std::filesystem::temp_directory_path() / "es-test-trace.json";
+			REQUIRE( Profiler::WriteTrace(path) );
+			std::ifstream in(path);
+			const std::string trace{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+			in.close();
+			std::filesystem::remove(path);
+			THEN( "it holds a complete event for each scope" ) {
+				CHECK( trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") );
+				CHECK( trace.ends_with("]}\n") );
+				CHECK( trace.find("{\"name\":\"inner scope\",\"ph\":\"X\"") != std::string::npos );
+			}
+			THEN( "the names are escaped" ) {
+				CHECK( trace.find("\"name\":\"outer \\\"scope\\\"\"") != std::string::npos );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark profiler scopes", "[!benchmark][Profiler]" ) {
+	BENCHMARK( "Disabled scope" ) {
+		Profiler::Scope scope("benchmark scope");
+	};
+	const EnabledProfiler enabled;
+	BENCHMARK( "Enabled scope" ) {
+		Profiler::Scope scope("benchmark scope");
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace
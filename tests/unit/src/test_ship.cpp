@@ -18,6 +18,9 @@ this program. If not, see <https://www.gnu.org/licenses/>.
 // Include only the tested class's header.
 #include "../../../source/Ship.h"
 
+// Include a helper for creating well-formed DataNodes.
+#include "datanode-factory.h"
+
 // ... and any system includes needed for the test file.
 #include <memory>
 #include <string>
@@ -98,7 +101,32 @@ SCENARIO( "A Ship::Bay instance is being copied", "[ship][bay]") {
 		}
 	}
 }
-// Constructing useful Ship instances requires Ship::Load, which requires all of GameData & runtime deps.
+
+SCENARIO( "A model ship is loaded", "[ship]" ) {
+	GIVEN( "a ship definition without outfits" ) {
+		const DataNode node = AsDataNode("ship \"Test Model\"\n"
+			"\tattributes\n"
+			"\t\tshields 1000\n"
+			"\t\thull 500\n"
+			"\t\t\"required crew\" 3\n"
+			"\t\tbunks 5\n"
+			"\t\tdrag 1");
+		Ship ship(node, nullptr);
+		WHEN( "it finishes loading as a new instance" ) {
+			ship.FinishLoading(true);
+			THEN( "it starts with full shields and hull" ) {
+				CHECK( ship.MaxShields() == 1000. );
+				CHECK( ship.MaxHull() == 500. );
+				CHECK( ship.ShieldLevel() == 1000. );
+				CHECK( ship.HullLevel() == 500. );
+			}
+			THEN( "it has the crew that it requires" ) {
+				CHECK( ship.Crew() == 3 );
+			}
+		}
+	}
+}
+// Constructing fully outfitted Ship instances requires all of GameData & runtime deps.
 
 
 
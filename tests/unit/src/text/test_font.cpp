@@ -0,0 +1,120 @@
+/* test_font.cpp
+Copyright (c) 2026 by the Endless Sky developers
+
+Endless Sky is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option) any later version.
+
+Endless Sky is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "es-test.hpp"
+
+// Include only the tested class's header.
+#include "../../../../source/text/Font.h"
+
+// ... and any system includes needed for the test file.
+#include <string>
+#include <vector>
+
+namespace { // test namespace
+
+// #region mock data
+
+// Each glyph is drawn as six vertices of four floats each.
+constexpr size_t GLYPH_FLOATS = 24;
+
+// A line of text like those drawn by the mission and shop panels.
+const std::string SAMPLE_LINE = "Deliver 25 tons of \"Medical Supplies\" to Hephaestus by Jan 4, 3014. _Accept";
+
+// #endregion mock data
+
+
+
+// #region unit tests
+SCENARIO( "Laying out the glyphs of a string", "[Font]" ) {
+	// Without a font image, all glyphs have no size, but they are laid out the same way.
+	const Font font;
+	std::vector<float> vertices;
+	GIVEN( "an empty string" ) {
+		font.BuildVertices("", vertices);
+		THEN( "there is nothing to draw" ) {
+			CHECK( vertices.empty() );
+		}
+	}
+	GIVEN( "a string with spaces" ) {
+		font.BuildVertices("a b  c", vertices);
+		THEN( "only the visible characters are drawn" ) {
+			CHECK( vertices.size() == 3 * GLYPH_FLOATS );
+		}
+	}
+	GIVEN( "a string of several characters" ) {
+		font.BuildVertices("AB", vertices);
+		REQUIRE( vertices.size() == 2 * GLYPH_FLOATS );
+		THEN( "each glyph is a separate quad of the triangle strip" ) {
+			// The first and last vertices of each quad are repeated.
+			for(size_t glyph = 0; glyph < 2; ++glyph)
+			{
+				const float *quad = vertices.data() + glyph * GLYPH_FLOATS;
+				for(size_t i = 0; i < 4; ++i)
+				{
+					CHECK( quad[i] == quad[4 + i] );
+					CHECK( quad[16 + i] == quad[20 + i] );
+				}
+			}
+		}
+		THEN( "the glyphs advance from left to right" ) {
+			CHECK( vertices[GLYPH_FLOATS] > vertices[0] );
+		}
+		THEN( "each glyph uses its own part of the texture" ) {
+			const float firstLeft = vertices[2];
+			const float secondLeft = vertices[GLYPH_FLOATS + 2];
+			CHECK( firstLeft == Approx(('A' - 32) / 98.f) );
+			CHECK( secondLeft == Approx(('B' - 32) / 98.f) );
+		}
+	}
+	GIVEN( "a string with an underlined shortcut" ) {
+		WHEN( "underlines are hidden" ) {
+			Font::ShowUnderlines(false);
+			font.BuildVertices("_Accept", vertices);
+			THEN( "the underscore is not drawn" ) {
+				CHECK( vertices.size() == 6 * GLYPH_FLOATS );
+			}
+		}
+		WHEN( "underlines are shown" ) {
+			Font::ShowUnderlines(true);
+			font.BuildVertices("_Accept", vertices);
+			Font::ShowUnderlines(false);
+			THEN( "the underline is drawn along with the character" ) {
+				CHECK( vertices.size() == 7 * GLYPH_FLOATS );
+			}
+		}
+	}
+}
+// #endregion unit tests
+
+// #region benchmarks
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Benchmark Font::BuildVertices", "[!benchmark][Font]" ) {
+	const Font font;
+	std::vector<float> vertices;
+	BENCHMARK( "Font::BuildVertices() with a short label" ) {
+		font.BuildVertices("Credits:", vertices);
+		return vertices.size();
+	};
+	BENCHMARK( "Font::BuildVertices() with a line of mission text" ) {
+		font.BuildVertices(SAMPLE_LINE, vertices);
+		return vertices.size();
+	};
+}
+#endif
+// #endregion benchmarks
+
+
+
+} // test namespace